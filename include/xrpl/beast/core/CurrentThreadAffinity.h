@@ -0,0 +1,40 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#ifndef BEAST_CORE_CURRENT_THREAD_AFFINITY_H_INCLUDED
+#define BEAST_CORE_CURRENT_THREAD_AFFINITY_H_INCLUDED
+
+#include <vector>
+
+namespace beast {
+
+/** Restricts the caller thread to a set of processors.
+
+    The thread may be scheduled on any of the listed processors. An empty
+    set leaves the affinity unchanged.
+
+    @return `false` if the platform does not support setting the affinity,
+            or if none of the listed processors could be used.
+*/
+bool
+setCurrentThreadAffinity(std::vector<unsigned> const& cpus);
+
+}  // namespace beast
+
+#endif
@@ -32,6 +32,7 @@
 #include <xrpl/beast/insight/Hook.h>
 #include <xrpl/beast/insight/HookImpl.h>
 #include <xrpl/beast/insight/NullCollector.h>
+#include <xrpl/beast/insight/PrometheusCollector.h>
 #include <xrpl/beast/insight/StatsDCollector.h>
 
 #endif
@@ -0,0 +1,78 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#ifndef BEAST_INSIGHT_PROMETHEUSCOLLECTOR_H_INCLUDED
+#define BEAST_INSIGHT_PROMETHEUSCOLLECTOR_H_INCLUDED
+
+#include <xrpl/beast/insight/Collector.h>
+#include <xrpl/beast/net/IPEndpoint.h>
+#include <xrpl/beast/utility/Journal.h>
+
+#include <string>
+
+namespace beast {
+namespace insight {
+
+/** A Collector that serves metrics to Prometheus over HTTP.
+
+    Metrics are kept in atomics, so updating them never blocks or allocates.
+    Each scrape of `/metrics` runs the hooks, at most once a second, and
+    reports the current values in the OpenMetrics text format: counters and
+    meters as counters, gauges as gauges, and events as histograms of their
+    durations in milliseconds. Metrics created with the same name are
+    reported as one. At most 16 connections are served at once; any more
+    are closed as soon as they are accepted.
+
+    Reference:
+        https://github.com/OpenObservability/OpenMetrics
+*/
+class PrometheusCollector : public Collector
+{
+public:
+    explicit PrometheusCollector() = default;
+
+    /** Return the current value of every metric in the exposition format.
+        The hooks are called first, unless they were called less than a
+        second ago.
+    */
+    virtual std::string
+    render() = 0;
+
+    /** Return the address metrics are served on.
+        If the configured port is zero, this has the port that was chosen.
+        If listening failed, the endpoint is unspecified, with port zero.
+    */
+    virtual IP::Endpoint
+    local_endpoint() const = 0;
+
+    /** Create a Prometheus collector.
+        @param address The IP address and port to serve the metrics on.
+        @param prefix A string pre-pended before each metric name.
+        @param journal Destination for logging output.
+    */
+    static std::shared_ptr<PrometheusCollector>
+    New(IP::Endpoint const& address,
+        std::string const& prefix,
+        Journal journal);
+};
+
+}  // namespace insight
+}  // namespace beast
+
+#endif
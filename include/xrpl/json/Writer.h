@@ -256,6 +256,13 @@ check(bool condition, std::string const& message)
         ripple::Throw<std::logic_error>(message);
 }
 
+inline void
+check(bool condition, char const* message)
+{
+    if (!condition)
+        ripple::Throw<std::logic_error>(message);
+}
+
 }  // namespace Json
 
 #endif
@@ -26,6 +26,7 @@
 #include <cstring>
 #include <limits>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -247,6 +248,20 @@ public:
     void
     swap(Value& other) noexcept;
 
+    /** Refer to an immutable value without copying it.
+
+        For an array or object, the result reads the elements of `value`,
+        which it keeps alive, and copies them only when it is first
+        modified. Even then the arrays and objects among the elements stay
+        shared until they are modified in turn. Copies of the result share
+        `value` as well, so a cached document can be handed out many times
+        for the cost of one pointer.
+        References to the elements are invalidated by that first change.
+        Other values are simply copied.
+    */
+    static Value
+    share(std::shared_ptr<Value const> value);
+
     ValueType
     type() const;
 
@@ -434,6 +449,18 @@ private:
     Value&
     resolveReference(char const* key, bool isStatic);
 
+    // Whether an array or object has elements, shared or its own
+    bool
+    hasMap() const;
+
+    // The elements of an array or object
+    ObjectValues const&
+    map() const;
+
+    // The elements of an array or object, copied first if they are shared
+    ObjectValues&
+    ownMap();
+
 private:
     union ValueHolder
     {
@@ -443,8 +470,11 @@ private:
         bool bool_;
         char* string_;
         ObjectValues* map_{nullptr};
+        std::shared_ptr<Value const>* shared_;
     } value_;
     ValueType type_ : 8;
+    // For a string, whether it is owned. For an array or object, whether
+    // shared_ is set rather than map_.
     int allocated_ : 1;  // Notes: if declared as bool, bitfield is useless.
 };
 
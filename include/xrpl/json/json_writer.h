@@ -24,6 +24,7 @@
 #include <xrpl/json/json_value.h>
 
 #include <ostream>
+#include <string>
 #include <vector>
 
 namespace Json {
@@ -69,6 +70,56 @@ private:
     std::string document_;
 };
 
+/** Writes a Value in compact form a piece at a time.
+
+    FastWriter renders the whole document into one string. This writer keeps
+    an explicit stack of the containers it is visiting instead, so a caller
+    can pull the output in bounded chunks (for example, as a socket drains)
+    without ever holding the complete serialization in memory.
+
+    The concatenated output is identical to FastWriter::write(). The Value
+    must outlive the writer and must not be modified while it is in use.
+*/
+class IncrementalWriter
+{
+public:
+    explicit IncrementalWriter(Value const& root);
+
+    IncrementalWriter(IncrementalWriter const&) = delete;
+    IncrementalWriter&
+    operator=(IncrementalWriter const&) = delete;
+
+    /** Serialize more of the document, appending it to `out`.
+
+        Stops once at least `bytes` characters were appended or the document
+        is finished, whichever comes first.
+
+        @return `true` if the whole document has been written.
+    */
+    bool
+    write(std::string& out, std::size_t bytes);
+
+    /** Returns `true` if the whole document has been written. */
+    bool
+    complete() const
+    {
+        return complete_;
+    }
+
+private:
+    struct Frame
+    {
+        Value const* value;
+        ValueConstIterator it;  // objects only
+        UInt index = 0;         // arrays only
+        bool first = true;
+    };
+
+    std::vector<Frame> stack_;
+    Value const* next_;
+    bool complete_ = false;
+};
+
 /** \brief Writes a Value in <a HREF="http://www.json.org">JSON</a> format in a
  * human friendly way.
  *
@@ -258,29 +309,35 @@ write_value(Write const& write, Value const& value)
 
         case arrayValue: {
             write("[", 1);
-            int const size = value.size();
-            for (int index = 0; index < size; ++index)
+            UInt index = 0;
+            for (auto it = value.begin(); it != value.end(); ++it)
             {
-                if (index > 0)
+                // Elements missing from a sparse array are written as null.
+                for (; index < it.index(); ++index)
+                {
+                    if (index > 0)
+                        write(",", 1);
+                    write("null", 4);
+                }
+
+                if (index++ > 0)
                     write(",", 1);
-                write_value(write, value[index]);
+                write_value(write, *it);
             }
             write("]", 1);
             break;
         }
 
         case objectValue: {
-            Value::Members const members = value.getMemberNames();
             write("{", 1);
-            for (auto it = members.begin(); it != members.end(); ++it)
+            for (auto it = value.begin(); it != value.end(); ++it)
             {
-                std::string const& name = *it;
-                if (it != members.begin())
+                if (it != value.begin())
                     write(",", 1);
 
-                write_string(write, valueToQuotedString(name.c_str()));
+                write_string(write, valueToQuotedString(it.memberName()));
                 write(":", 1);
-                write_value(write, value[name]);
+                write_value(write, *it);
             }
             write("}", 1);
             break;
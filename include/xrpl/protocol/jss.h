@@ -252,6 +252,7 @@ JSS(dir_index);               // out: DirectoryEntryIterator
 JSS(dir_root);                // out: DirectoryEntryIterator
 JSS(discounted_fee);          // out: amm_info
 JSS(domain);                  // out: ValidatorInfo, Manifest
+JSS(dropped);                 // out: NetworkOPs, PerfLog
 JSS(drops);                   // out: TxQ
 JSS(duration_us);             // out: NetworkOPs
 JSS(effective);               // out: ValidatorList
@@ -314,6 +315,7 @@ JSS(high);                    // out: BookChanges
 JSS(highest_sequence);        // out: AccountInfo
 JSS(highest_ticket);          // out: AccountInfo
 JSS(historical_perminute);    // historical_perminute.
+JSS(history);                 // out: FetchInfo
 JSS(holders);                 // out: MPTHolders
 JSS(hostid);                  // out: NetworkOPs
 JSS(hotwallet);               // in: GatewayBalances
@@ -321,6 +323,7 @@ JSS(id);                      // websocket.
 JSS(ident);                   // in: AccountCurrencies, AccountInfo,
                               //     OwnerInfo
 JSS(ignore_default);          // in: AccountLines
+JSS(in_flight);               // out: FetchInfo
 JSS(inLedger);                // out: tx/Transaction
 JSS(inbound);                 // out: PeerImp
 JSS(index);                   // in: LedgerEntry
@@ -360,10 +363,14 @@ JSS(last_refresh_message);    // out: ValidatorSite
 JSS(ledger);                  // in: NetworkOPs, LedgerCleaner,
                               //     RPCHelpers
                               // out: NetworkOPs, PeerImp
+JSS(ledger_cache_bytes);      // out: GetCounts
+JSS(ledger_cache_evictions);  // out: GetCounts
 JSS(ledger_current_index);    // out: NetworkOPs, RPCHelpers,
                               //      LedgerCurrent, LedgerAccept,
                               //      AccountLines
 JSS(ledger_data);             // out: LedgerHeader
+JSS(ledger_data_hit_rate);    // out: GetCounts
+JSS(ledger_data_size);        // out: GetCounts
 JSS(ledger_hash);             // in: RPCHelpers, LedgerRequest,
                               //     RipplePathFind, TransactionEntry,
                               //     handlers/Ledger
@@ -506,6 +513,7 @@ JSS(ports);                   // out: NetworkOPs
 JSS(previous);                // out: Reservations
 JSS(previous_ledger);         // out: LedgerPropose
 JSS(price);                   // out: amm_info, AuctionSlot
+JSS(profile);                 // out: NetworkOPs, PerfLog
 JSS(proof);                   // in: BookOffers
 JSS(propose_seq);             // out: LedgerPropose
 JSS(proposers);               // out: NetworkOPs, LedgerConsensus
@@ -554,6 +562,10 @@ JSS(role);                    // out: Ping.cpp
 JSS(rpc);
 JSS(rt_accounts);             // in: Subscribe, Unsubscribe
 JSS(running_duration_us);
+JSS(sample_interval_us);      // out: NetworkOPs, PerfLog
+JSS(samples);                 // out: NetworkOPs, PerfLog
+JSS(save_queue);              // out: GetCounts
+JSS(save_queue_age_ms);       // out: GetCounts
 JSS(search_depth);            // in: RipplePathFind
 JSS(searched_all);            // out: Tx
 JSS(secret);                  // in: TransactionSign,
@@ -589,6 +601,7 @@ JSS(source_account);          // in: PathRequest, RipplePathFind
 JSS(source_amount);           // in: PathRequest, RipplePathFind
 JSS(source_currencies);       // in: PathRequest, RipplePathFind
 JSS(source_tag);              // out: AccountChannels
+JSS(stacks);                  // out: NetworkOPs, PerfLog
 JSS(stand_alone);             // out: NetworkOPs
 JSS(standard_deviation);      // out: get_aggregate_price
 JSS(start);                   // in: TxHistory
@@ -716,6 +729,7 @@ JSS(vote_slots);                // out: amm_info
 JSS(vote_weight);               // out: amm_info
 JSS(warning);                   // rpc:
 JSS(warnings);                  // out: server_info, server_state
+JSS(window);                    // out: FetchInfo
 JSS(workers);
 JSS(write_load);              // out: GetCounts
 // clang-format on
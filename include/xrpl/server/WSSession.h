@@ -20,6 +20,7 @@
 #ifndef RIPPLE_SERVER_WSSESSION_H_INCLUDED
 #define RIPPLE_SERVER_WSSESSION_H_INCLUDED
 
+#include <xrpl/json/json_writer.h>
 #include <xrpl/server/Handoff.h>
 #include <xrpl/server/Port.h>
 #include <xrpl/server/Writer.h>
@@ -33,6 +34,7 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -104,6 +106,66 @@ public:
     }
 };
 
+/** A message backed by an immutable buffer shared with other sessions.
+
+    The same serialized payload may be queued on any number of sessions;
+    each message only tracks how much of the buffer it has written.
+*/
+class SharedWSMsg : public WSMsg
+{
+    std::shared_ptr<std::string const> buf_;
+    std::size_t pos_ = 0;
+    std::size_t n_ = 0;
+
+public:
+    explicit SharedWSMsg(std::shared_ptr<std::string const> buf)
+        : buf_(std::move(buf))
+    {
+    }
+
+    std::pair<boost::tribool, std::vector<boost::asio::const_buffer>>
+    prepare(std::size_t bytes, std::function<void(void)>) override
+    {
+        pos_ += n_;
+        auto const remaining = buf_->size() - pos_;
+        if (remaining == 0)
+            return {true, {}};
+        n_ = std::min(bytes, remaining);
+        return {
+            n_ == remaining,
+            {boost::asio::const_buffer(buf_->data() + pos_, n_)}};
+    }
+};
+
+/** A message serialized from a Json::Value as the session drains it.
+
+    Only one piece of the serialization exists at a time, so sending a large
+    document does not require a second copy of it in memory.
+*/
+class JsonWSMsg : public WSMsg
+{
+    Json::Value const jv_;
+    Json::IncrementalWriter writer_;
+    std::string buf_;
+
+public:
+    explicit JsonWSMsg(Json::Value&& jv) : jv_(std::move(jv)), writer_(jv_)
+    {
+    }
+
+    std::pair<boost::tribool, std::vector<boost::asio::const_buffer>>
+    prepare(std::size_t bytes, std::function<void(void)>) override
+    {
+        buf_.clear();
+        if (writer_.complete())
+            return {true, {}};
+        writer_.write(buf_, bytes);
+        return {
+            writer_.complete(),
+            {boost::asio::const_buffer(buf_.data(), buf_.size())}};
+    }
+};
+
 struct WSSession
 {
     std::shared_ptr<void> appDefined;
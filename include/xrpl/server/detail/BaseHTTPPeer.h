@@ -22,10 +22,12 @@
 
 #include <xrpl/basics/Log.h>
 #include <xrpl/beast/net/IPAddressConversion.h>
+#include <xrpl/beast/rfc2616.h>
 #include <xrpl/beast/utility/instrumentation.h>
 #include <xrpl/server/Session.h>
 #include <xrpl/server/detail/io_list.h>
 
+#include <boost/asio/basic_waitable_timer.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/spawn.hpp>
 #include <boost/asio/ssl/stream.hpp>
@@ -38,6 +40,7 @@
 
 #include <atomic>
 #include <chrono>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -45,7 +48,13 @@
 
 namespace ripple {
 
-/** Represents an active connection. */
+/** Represents an active connection.
+
+    Requests that the client pipelines are handed to the handler as soon as
+    they are read, without waiting for the replies to the earlier ones. Each
+    request gets a Session of its own, and the replies are sent back in the
+    order the requests arrived.
+*/
 template <class Handler, class Impl>
 class BaseHTTPPeer : public io_list::work, public Session
 {
@@ -54,11 +63,15 @@ protected:
     using error_code = boost::system::error_code;
     using endpoint_type = boost::asio::ip::tcp::endpoint;
     using yield_context = boost::asio::yield_context;
+    using waitable_timer = boost::asio::basic_waitable_timer<clock_type>;
 
     enum {
         // Size of our read/write buffer
         bufferSize = 4 * 1024,
 
+        // Max requests read ahead of the replies still to be sent
+        pipelineLimit = 16,
+
         // Max seconds without completing a message
         timeoutSeconds = 30,
         timeoutSecondsLocal = 3  // used for localhost clients
@@ -77,10 +90,88 @@ protected:
         std::size_t used;
     };
 
+    /** A request read from the connection, and the reply to it. */
+    class Exchange : public Session,
+                     public std::enable_shared_from_this<Exchange>
+    {
+    public:
+        Exchange(std::shared_ptr<Impl> const& peer, http_request_type&& req)
+            : peer_(peer), request_(std::move(req))
+        {
+        }
+
+        beast::Journal
+        journal() override
+        {
+            return peer_->journal_;
+        }
+
+        Port const&
+        port() override
+        {
+            return peer_->port_;
+        }
+
+        beast::IP::Endpoint
+        remoteAddress() override
+        {
+            return beast::IPAddressConversion::from_asio(
+                peer_->remote_address_);
+        }
+
+        http_request_type&
+        request() override
+        {
+            return request_;
+        }
+
+        void
+        write(void const* buffer, std::size_t bytes) override;
+
+        void
+        write(std::shared_ptr<Writer> const& writer, bool keep_alive) override;
+
+        std::shared_ptr<Session>
+        detach() override
+        {
+            return this->shared_from_this();
+        }
+
+        void
+        complete() override;
+
+        void
+        close(bool graceful) override;
+
+        std::shared_ptr<WSSession>
+        websocketUpgrade() override;
+
+    private:
+        friend class BaseHTTPPeer;
+
+        // Called by the writer once it has more data.
+        void
+        resume();
+
+        std::shared_ptr<Impl> const peer_;
+        http_request_type request_;
+
+        std::mutex mutex_;
+        std::vector<buffer> wq_;
+
+        // Only used on the peer's strand
+        std::shared_ptr<Writer> writer_;
+        bool keep_alive_ = true;
+        bool waiting_ = false;
+        bool complete_ = false;
+        bool close_ = false;
+    };
+
     Port const& port_;
     Handler& handler_;
     boost::asio::executor_work_guard<boost::asio::executor> work_;
     boost::asio::strand<boost::asio::executor> strand_;
+    waitable_timer timer_;
     endpoint_type remote_address_;
     beast::Journal const journal_;
 
@@ -89,11 +180,16 @@ protected:
 
     boost::asio::streambuf read_buf_;
     http_request_type message_;
+
+    // Requests awaiting their replies, oldest first. Only the reply to the
+    // first one is being sent.
+    std::deque<std::shared_ptr<Exchange>> exchanges_;
     std::vector<buffer> wq_;
-    std::vector<buffer> wq2_;
-    std::mutex mutex_;
-    bool graceful_ = false;
-    bool complete_ = false;
+    bool reading_ = false;
+    bool sending_ = false;
+    bool upgrade_ = false;
+    bool closing_ = false;
+    bool closed_ = false;
     boost::system::error_code ec_;
 
     int request_count_ = 0;
@@ -133,6 +229,9 @@ protected:
     void
     fail(error_code ec, char const* what);
 
+    std::chrono::seconds
+    timeout() const;
+
     void
     start_timer();
 
@@ -145,16 +244,23 @@ protected:
     void
     do_read(yield_context do_yield);
 
+    bool
+    dispatch();
+
+    Session&
+    begin_exchange();
+
     void
-    on_write(error_code const& ec, std::size_t bytes_transferred);
+    send();
 
     void
-    do_writer(
-        std::shared_ptr<Writer> const& writer,
-        bool keep_alive,
-        yield_context do_yield);
+    do_send(yield_context do_yield);
 
-    virtual void
+    void
+    advance();
+
+    // Returns `false` if the connection was handed off or failed.
+    virtual bool
     do_request() = 0;
 
     virtual void
@@ -217,6 +323,7 @@ BaseHTTPPeer<Handler, Impl>::BaseHTTPPeer(
     , handler_(handler)
     , work_(executor)
     , strand_(executor)
+    , timer_(executor)
     , remote_address_(remote_address)
     , journal_(journal)
 {
@@ -247,6 +354,9 @@ BaseHTTPPeer<Handler, Impl>::close()
             std::bind(
                 (void(BaseHTTPPeer::*)(void)) & BaseHTTPPeer::close,
                 impl().shared_from_this()));
+    // The replies still owed hold the peer, so drop them
+    exchanges_.clear();
+    timer_.cancel();
     boost::beast::get_lowest_layer(impl().stream_).close();
 }
 
@@ -261,18 +371,26 @@ BaseHTTPPeer<Handler, Impl>::fail(error_code ec, char const* what)
         ec_ = ec;
         JLOG(journal_.trace())
             << id_ << std::string(what) << ": " << ec.message();
+        exchanges_.clear();
+        timer_.cancel();
         boost::beast::get_lowest_layer(impl().stream_).close();
     }
 }
 
+template <class Handler, class Impl>
+std::chrono::seconds
+BaseHTTPPeer<Handler, Impl>::timeout() const
+{
+    return std::chrono::seconds(
+        remote_address_.address().is_loopback() ? timeoutSecondsLocal
+                                                : timeoutSeconds);
+}
+
 template <class Handler, class Impl>
 void
 BaseHTTPPeer<Handler, Impl>::start_timer()
 {
-    boost::beast::get_lowest_layer(impl().stream_)
-        .expires_after(std::chrono::seconds(
-            remote_address_.address().is_loopback() ? timeoutSecondsLocal
-                                                    : timeoutSeconds));
+    boost::beast::get_lowest_layer(impl().stream_).expires_after(timeout());
 }
 
 // Convenience for discarding the error code
@@ -295,123 +413,226 @@ BaseHTTPPeer<Handler, Impl>::on_timer()
 
 //------------------------------------------------------------------------------
 
+// Read requests until the pipeline is full or no more will be read.
 template <class Handler, class Impl>
 void
 BaseHTTPPeer<Handler, Impl>::do_read(yield_context do_yield)
 {
-    complete_ = false;
-    error_code ec;
-    start_timer();
-    boost::beast::http::async_read(
-        impl().stream_, read_buf_, message_, do_yield[ec]);
-    cancel_timer();
-    if (ec == boost::beast::http::error::end_of_stream)
-        return do_close();
-    if (ec == boost::beast::error::timeout)
-        return on_timer();
-    if (ec)
-        return fail(ec, "http::read");
-    do_request();
+    reading_ = true;
+    while (!closing_ && !ec_ && exchanges_.size() < pipelineLimit)
+    {
+        // While replies are owed the client is waiting on us, so the next
+        // request is not timed. The stream timer is shared with the writes,
+        // which only change it for the direction that is not in use.
+        bool const idle = exchanges_.empty();
+        if (idle)
+            start_timer();
+        else
+            cancel_timer();
+        message_ = {};
+        error_code ec;
+        boost::beast::http::async_read(
+            impl().stream_, read_buf_, message_, do_yield[ec]);
+        if (idle)
+            cancel_timer();
+        timer_.cancel();
+        if (ec == boost::beast::http::error::end_of_stream ||
+            (ec == boost::asio::error::operation_aborted && closing_))
+        {
+            // Replies to the requests already read are still sent
+            closing_ = true;
+            break;
+        }
+        reading_ = !ec;
+        if (ec == boost::beast::error::timeout)
+            return on_timer();
+        if (ec)
+            return fail(ec, "http::read");
+
+        // An upgrade hands the stream over, so it must wait until the
+        // replies to the earlier requests are sent.
+        if (!exchanges_.empty() &&
+            message_.find(boost::beast::http::field::upgrade) !=
+                message_.end())
+        {
+            upgrade_ = true;
+            break;
+        }
+
+        if (!dispatch())
+        {
+            reading_ = false;
+            return;
+        }
+    }
+    reading_ = false;
+    advance();
+}
+
+// Hand the request in message_ to the handler.
+template <class Handler, class Impl>
+bool
+BaseHTTPPeer<Handler, Impl>::dispatch()
+{
+    if (!beast::rfc2616::is_keep_alive(message_))
+        closing_ = true;
+    return do_request();
+}
+
+// Queue the request in message_ for a reply, and return its session.
+template <class Handler, class Impl>
+Session&
+BaseHTTPPeer<Handler, Impl>::begin_exchange()
+{
+    exchanges_.push_back(std::make_shared<Exchange>(
+        impl().shared_from_this(), std::move(message_)));
+    return *exchanges_.back();
 }
 
-// Send everything in the write queue.
-// The write queue must not be empty upon entry.
+// Start sending replies, unless that is already underway.
 template <class Handler, class Impl>
 void
-BaseHTTPPeer<Handler, Impl>::on_write(
-    error_code const& ec,
-    std::size_t bytes_transferred)
+BaseHTTPPeer<Handler, Impl>::send()
 {
-    cancel_timer();
-    if (ec == boost::beast::error::timeout)
-        return on_timer();
-    if (ec)
-        return fail(ec, "write");
-    bytes_out_ += bytes_transferred;
-    {
-        std::lock_guard lock(mutex_);
-        wq2_.clear();
-        wq2_.reserve(wq_.size());
-        std::swap(wq2_, wq_);
-    }
-    if (!wq2_.empty())
-    {
-        std::vector<boost::asio::const_buffer> v;
-        v.reserve(wq2_.size());
-        for (auto const& b : wq2_)
-            v.emplace_back(b.data.get(), b.bytes);
-        start_timer();
-        return boost::asio::async_write(
-            impl().stream_,
-            v,
-            bind_executor(
-                strand_,
-                std::bind(
-                    &BaseHTTPPeer::on_write,
-                    impl().shared_from_this(),
-                    std::placeholders::_1,
-                    std::placeholders::_2)));
-    }
-    if (!complete_)
+    if (sending_ || exchanges_.empty() || ec_)
         return;
-    if (graceful_)
-        return do_close();
+    sending_ = true;
     boost::asio::spawn(
         strand_,
         std::bind(
-            &BaseHTTPPeer<Handler, Impl>::do_read,
+            &BaseHTTPPeer<Handler, Impl>::do_send,
             impl().shared_from_this(),
             std::placeholders::_1));
 }
 
+// Send the replies in request order, for as long as they are ready.
 template <class Handler, class Impl>
 void
-BaseHTTPPeer<Handler, Impl>::do_writer(
-    std::shared_ptr<Writer> const& writer,
-    bool keep_alive,
-    yield_context do_yield)
+BaseHTTPPeer<Handler, Impl>::do_send(yield_context do_yield)
 {
-    std::function<void(void)> resume;
+    while (!exchanges_.empty())
     {
-        auto const p = impl().shared_from_this();
-        resume = std::function<void(void)>([this, p, writer, keep_alive]() {
-            boost::asio::spawn(
-                strand_,
-                std::bind(
-                    &BaseHTTPPeer<Handler, Impl>::do_writer,
-                    p,
-                    writer,
-                    keep_alive,
-                    std::placeholders::_1));
-        });
-    }
+        auto const x = exchanges_.front();
 
-    for (;;)
-    {
-        if (!writer->prepare(bufferSize, resume))
-            return;
-        error_code ec;
-        auto const bytes_transferred = boost::asio::async_write(
-            impl().stream_,
-            writer->data(),
-            boost::asio::transfer_at_least(1),
-            do_yield[ec]);
-        if (ec)
-            return fail(ec, "writer");
-        writer->consume(bytes_transferred);
-        if (writer->complete())
+        {
+            std::lock_guard lock(x->mutex_);
+            std::swap(wq_, x->wq_);
+        }
+        if (!wq_.empty())
+        {
+            std::vector<boost::asio::const_buffer> v;
+            v.reserve(wq_.size());
+            for (auto const& b : wq_)
+                v.emplace_back(b.data.get(), b.bytes);
+            error_code ec;
+            start_timer();
+            auto const bytes_transferred =
+                boost::asio::async_write(impl().stream_, v, do_yield[ec]);
+            cancel_timer();
+            wq_.clear();
+            if (ec == boost::beast::error::timeout)
+                return on_timer();
+            if (ec)
+                return fail(ec, "write");
+            bytes_out_ += bytes_transferred;
+            continue;
+        }
+
+        if (x->writer_)
+        {
+            if (x->waiting_)
+                break;
+            if (!x->writer_->prepare(bufferSize, [x]() { x->resume(); }))
+            {
+                x->waiting_ = true;
+                break;
+            }
+            error_code ec;
+            start_timer();
+            auto const bytes_transferred = boost::asio::async_write(
+                impl().stream_,
+                x->writer_->data(),
+                boost::asio::transfer_at_least(1),
+                do_yield[ec]);
+            cancel_timer();
+            if (ec == boost::beast::error::timeout)
+                return on_timer();
+            if (ec)
+                return fail(ec, "writer");
+            bytes_out_ += bytes_transferred;
+            x->writer_->consume(bytes_transferred);
+            if (x->writer_->complete())
+            {
+                x->writer_.reset();
+                (x->keep_alive_ ? x->complete_ : x->close_) = true;
+            }
+            continue;
+        }
+
+        if (!x->complete_ && !x->close_)
             break;
+
+        exchanges_.pop_front();
+        if (x->close_)
+        {
+            // Requests read after this one go unanswered
+            closing_ = true;
+            exchanges_.clear();
+        }
     }
+    sending_ = false;
+    advance();
+}
 
-    if (!keep_alive)
-        return do_close();
+// Read, close or wait, as the state of the pipeline requires.
+template <class Handler, class Impl>
+void
+BaseHTTPPeer<Handler, Impl>::advance()
+{
+    if (ec_ || closed_)
+        return;
 
-    boost::asio::spawn(
-        strand_,
-        std::bind(
-            &BaseHTTPPeer<Handler, Impl>::do_read,
-            impl().shared_from_this(),
-            std::placeholders::_1));
+    if (exchanges_.empty())
+    {
+        if (upgrade_)
+        {
+            upgrade_ = false;
+            if (!dispatch())
+                return;
+        }
+        else if (closing_)
+        {
+            // A pending read must finish before the stream is shut down
+            if (reading_)
+                return boost::beast::get_lowest_layer(impl().stream_)
+                    .cancel();
+            closed_ = true;
+            return do_close();
+        }
+        else if (reading_)
+        {
+            // The pending read was not timed while replies were owed
+            timer_.expires_after(timeout());
+            timer_.async_wait(bind_executor(
+                strand_,
+                [p = impl().shared_from_this()](error_code const& ec) {
+                    if (ec != boost::asio::error::operation_aborted)
+                        p->on_timer();
+                }));
+        }
+    }
+
+    if (!reading_ && !closing_ && !upgrade_ &&
+        exchanges_.size() < pipelineLimit)
+    {
+        reading_ = true;
+        boost::asio::spawn(
+            strand_,
+            std::bind(
+                &BaseHTTPPeer<Handler, Impl>::do_read,
+                impl().shared_from_this(),
+                std::placeholders::_1));
+    }
 }
 
 //------------------------------------------------------------------------------
@@ -419,43 +640,100 @@ BaseHTTPPeer<Handler, Impl>::do_writer(
 // Send a copy of the data.
 template <class Handler, class Impl>
 void
-BaseHTTPPeer<Handler, Impl>::write(void const* buf, std::size_t bytes)
+BaseHTTPPeer<Handler, Impl>::Exchange::write(
+    void const* buf,
+    std::size_t bytes)
 {
     if (bytes == 0)
         return;
     if ([&] {
             std::lock_guard lock(mutex_);
             wq_.emplace_back(buf, bytes);
-            return wq_.size() == 1 && wq2_.size() == 0;
+            return wq_.size() == 1;
         }())
-    {
-        if (!strand_.running_in_this_thread())
-            return post(
-                strand_,
-                std::bind(
-                    &BaseHTTPPeer::on_write,
-                    impl().shared_from_this(),
-                    error_code{},
-                    0));
-        else
-            return on_write(error_code{}, 0);
-    }
+        post(peer_->strand_, [p = peer_]() { p->send(); });
 }
 
 template <class Handler, class Impl>
 void
-BaseHTTPPeer<Handler, Impl>::write(
+BaseHTTPPeer<Handler, Impl>::Exchange::write(
     std::shared_ptr<Writer> const& writer,
     bool keep_alive)
 {
-    boost::asio::spawn(bind_executor(
-        strand_,
-        std::bind(
-            &BaseHTTPPeer<Handler, Impl>::do_writer,
-            impl().shared_from_this(),
-            writer,
-            keep_alive,
-            std::placeholders::_1)));
+    post(
+        peer_->strand_,
+        [this, self = this->shared_from_this(), writer, keep_alive]() {
+            XRPL_ASSERT(
+                !writer_,
+                "ripple::BaseHTTPPeer::Exchange::write(Writer) : one writer "
+                "at a time");
+            writer_ = writer;
+            keep_alive_ = keep_alive;
+            peer_->send();
+        });
+}
+
+template <class Handler, class Impl>
+void
+BaseHTTPPeer<Handler, Impl>::Exchange::resume()
+{
+    post(peer_->strand_, [this, self = this->shared_from_this()]() {
+        waiting_ = false;
+        peer_->send();
+    });
+}
+
+// Called to indicate the response has been written(but not sent)
+template <class Handler, class Impl>
+void
+BaseHTTPPeer<Handler, Impl>::Exchange::complete()
+{
+    post(peer_->strand_, [this, self = this->shared_from_this()]() {
+        complete_ = true;
+        peer_->send();
+    });
+}
+
+// Called from the Handler to close the session.
+template <class Handler, class Impl>
+void
+BaseHTTPPeer<Handler, Impl>::Exchange::close(bool graceful)
+{
+    if (!graceful)
+        return peer_->close();
+    post(peer_->strand_, [this, self = this->shared_from_this()]() {
+        close_ = true;
+        peer_->send();
+    });
+}
+
+template <class Handler, class Impl>
+std::shared_ptr<WSSession>
+BaseHTTPPeer<Handler, Impl>::Exchange::websocketUpgrade()
+{
+    // Only the connection itself is upgraded, from onHandoff
+    UNREACHABLE("ripple::BaseHTTPPeer::Exchange::websocketUpgrade : called");
+    return nullptr;
+}
+
+//------------------------------------------------------------------------------
+
+// The connection is a Session only for onAccept, onHandoff and onClose.
+// Replies are written to the Session of each request.
+
+template <class Handler, class Impl>
+void
+BaseHTTPPeer<Handler, Impl>::write(void const*, std::size_t)
+{
+    UNREACHABLE("ripple::BaseHTTPPeer::write : called on the connection");
+}
+
+template <class Handler, class Impl>
+void
+BaseHTTPPeer<Handler, Impl>::write(std::shared_ptr<Writer> const&, bool)
+{
+    UNREACHABLE(
+        "ripple::BaseHTTPPeer::write(Writer) : called on the connection");
 }
 
 // DEPRECATED
@@ -467,39 +745,14 @@ BaseHTTPPeer<Handler, Impl>::detach()
     return impl().shared_from_this();
 }
 
-// DEPRECATED
-// Called to indicate the response has been written(but not sent)
 template <class Handler, class Impl>
 void
 BaseHTTPPeer<Handler, Impl>::complete()
 {
-    if (!strand_.running_in_this_thread())
-        return post(
-            strand_,
-            std::bind(
-                &BaseHTTPPeer<Handler, Impl>::complete,
-                impl().shared_from_this()));
-
-    message_ = {};
-    complete_ = true;
-
-    {
-        std::lock_guard lock(mutex_);
-        if (!wq_.empty() && !wq2_.empty())
-            return;
-    }
-
-    // keep-alive
-    boost::asio::spawn(bind_executor(
-        strand_,
-        std::bind(
-            &BaseHTTPPeer<Handler, Impl>::do_read,
-            impl().shared_from_this(),
-            std::placeholders::_1)));
+    UNREACHABLE("ripple::BaseHTTPPeer::complete : called on the connection");
 }
 
-// DEPRECATED
-// Called from the Handler to close the session.
+// Close the connection, after the replies still owed if graceful.
 template <class Handler, class Impl>
 void
 BaseHTTPPeer<Handler, Impl>::close(bool graceful)
@@ -513,19 +766,10 @@ BaseHTTPPeer<Handler, Impl>::close(bool graceful)
                 impl().shared_from_this(),
                 graceful));
 
-    complete_ = true;
-    if (graceful)
-    {
-        graceful_ = true;
-        {
-            std::lock_guard lock(mutex_);
-            if (!wq_.empty() || !wq2_.empty())
-                return;
-        }
-        return do_close();
-    }
-
-    boost::beast::get_lowest_layer(impl().stream_).close();
+    if (!graceful)
+        return close();
+    closing_ = true;
+    advance();
 }
 
 }  // namespace ripple
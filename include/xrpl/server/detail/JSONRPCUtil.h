@@ -23,6 +23,13 @@
 #include <xrpl/beast/utility/Journal.h>
 #include <xrpl/json/Output.h>
 #include <xrpl/json/json_value.h>
+#include <xrpl/json/json_writer.h>
+#include <xrpl/server/Writer.h>
+
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
 
 namespace ripple {
 
@@ -33,6 +40,81 @@ HTTPReply(
     Json::Output const&,
     beast::Journal j);
 
+/** Write the status line and headers of a JSON-RPC reply.
+
+    @param contentLength The size of the body, or std::nullopt to announce
+                         chunked transfer encoding instead.
+*/
+void
+HTTPReplyHeaders(
+    int nStatus,
+    std::optional<std::size_t> contentLength,
+    Json::Output const&);
+
+/** Streams a JSON-RPC reply to an HTTP session as the socket drains.
+
+    The first chunk of the body is serialized up front. If that already holds
+    the whole document, the reply goes out with a Content-Length, exactly as
+    HTTPReply would send it. Otherwise, when the client accepts it, the body
+    is sent with chunked transfer encoding and each further chunk is only
+    serialized when the session asks for more data. A large reply therefore
+    never exists in serialized form all at once, and the first bytes leave
+    before the last ones are rendered.
+
+    The further chunks are serialized by prepare(), which the session calls
+    on its I/O thread. Each call renders at most about one chunk, so the
+    thread is held for a bounded time, as it is for the socket write.
+*/
+class JsonReplyWriter : public Writer
+{
+public:
+    /** Size of each serialized piece of the body. */
+    static constexpr std::size_t chunkSize = 64 * 1024;
+
+    /** Create the writer.
+
+        @param nStatus The HTTP status of the reply.
+        @param reply The document to send. It is owned by the writer.
+        @param chunked `true` if the client accepts chunked encoding.
+        @param onComplete Called with the size of the serialized document,
+                          without any framing, once it is all serialized.
+    */
+    JsonReplyWriter(
+        int nStatus,
+        Json::Value&& reply,
+        bool chunked,
+        std::function<void(std::size_t)> onComplete = {});
+
+    bool
+    complete() override;
+
+    void
+    consume(std::size_t bytes) override;
+
+    bool
+    prepare(std::size_t bytes, std::function<void(void)> resume) override;
+
+    std::vector<boost::asio::const_buffer>
+    data() override;
+
+private:
+    // Frame the next piece of the body as one chunk. If `piece` is empty,
+    // the piece is serialized from the document.
+    void
+    appendChunk(std::string_view piece);
+
+    void
+    finish();
+
+    Json::Value const reply_;
+    Json::IncrementalWriter writer_;
+    std::function<void(std::size_t)> onComplete_;
+    std::string buf_;
+    std::size_t pos_ = 0;
+    std::size_t payloadSize_ = 0;
+    bool last_ = false;
+};
+
 }  // namespace ripple
 
 #endif
@@ -62,7 +62,7 @@ public:
     websocketUpgrade() override;
 
 private:
-    void
+    bool
     do_request() override;
 
     void
@@ -137,14 +137,14 @@ PlainHTTPPeer<Handler>::websocketUpgrade()
 }
 
 template <class Handler>
-void
+bool
 PlainHTTPPeer<Handler>::do_request()
 {
     ++this->request_count_;
     auto const what = this->handler_.onHandoff(
         this->session(), std::move(this->message_), this->remote_address_);
     if (what.moved)
-        return;
+        return false;
     boost::system::error_code ec;
     if (what.response)
     {
@@ -152,17 +152,25 @@ PlainHTTPPeer<Handler>::do_request()
         if (!what.keep_alive)
             socket_.shutdown(socket_type::shutdown_receive, ec);
         if (ec)
-            return this->fail(ec, "request");
-        return this->write(what.response, what.keep_alive);
+        {
+            this->fail(ec, "request");
+            return false;
+        }
+        this->begin_exchange().write(what.response, what.keep_alive);
+        return true;
     }
 
     // Perform half-close when Connection: close and not SSL
     if (!beast::rfc2616::is_keep_alive(this->message_))
         socket_.shutdown(socket_type::shutdown_receive, ec);
     if (ec)
-        return this->fail(ec, "request");
+    {
+        this->fail(ec, "request");
+        return false;
+    }
     // legacy
-    this->handler_.onRequest(this->session());
+    this->handler_.onRequest(this->begin_exchange());
+    return true;
 }
 
 template <class Handler>
@@ -71,7 +71,7 @@ private:
     void
     do_handshake(yield_context do_yield);
 
-    void
+    bool
     do_request() override;
 
     void
@@ -176,7 +176,7 @@ SSLHTTPPeer<Handler>::do_handshake(yield_context do_yield)
 }
 
 template <class Handler>
-void
+bool
 SSLHTTPPeer<Handler>::do_request()
 {
     ++this->request_count_;
@@ -186,11 +186,15 @@ SSLHTTPPeer<Handler>::do_request()
         std::move(this->message_),
         this->remote_address_);
     if (what.moved)
-        return;
+        return false;
     if (what.response)
-        return this->write(what.response, what.keep_alive);
+    {
+        this->begin_exchange().write(what.response, what.keep_alive);
+        return true;
+    }
     // legacy
-    this->handler_.onRequest(this->session());
+    this->handler_.onRequest(this->begin_exchange());
+    return true;
 }
 
 template <class Handler>
@@ -0,0 +1,71 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpl/beast/core/CurrentThreadAffinity.h>
+
+#include <boost/predef.h>
+
+#if BOOST_OS_LINUX
+#include <pthread.h>
+#include <sched.h>
+
+namespace beast::detail {
+
+inline bool
+setCurrentThreadAffinityImpl(std::vector<unsigned> const& cpus)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (auto const cpu : cpus)
+    {
+        if (cpu < CPU_SETSIZE)
+            CPU_SET(cpu, &set);
+    }
+
+    if (CPU_COUNT(&set) == 0)
+        return false;
+
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+}  // namespace beast::detail
+#else
+namespace beast::detail {
+
+inline bool
+setCurrentThreadAffinityImpl(std::vector<unsigned> const&)
+{
+    return false;
+}
+
+}  // namespace beast::detail
+#endif  // BOOST_OS_LINUX
+
+namespace beast {
+
+bool
+setCurrentThreadAffinity(std::vector<unsigned> const& cpus)
+{
+    if (cpus.empty())
+        return true;
+
+    return detail::setCurrentThreadAffinityImpl(cpus);
+}
+
+}  // namespace beast
@@ -0,0 +1,830 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpl/beast/core/List.h>
+#include <xrpl/beast/insight/CounterImpl.h>
+#include <xrpl/beast/insight/EventImpl.h>
+#include <xrpl/beast/insight/GaugeImpl.h>
+#include <xrpl/beast/insight/Hook.h>
+#include <xrpl/beast/insight/HookImpl.h>
+#include <xrpl/beast/insight/MeterImpl.h>
+#include <xrpl/beast/insight/PrometheusCollector.h>
+#include <xrpl/beast/net/IPAddressConversion.h>
+#include <xrpl/beast/net/IPEndpoint.h>
+#include <xrpl/beast/utility/Journal.h>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/core/tcp_stream.hpp>
+#include <boost/beast/http/empty_body.hpp>
+#include <boost/beast/http/message.hpp>
+#include <boost/beast/http/read.hpp>
+#include <boost/beast/http/string_body.hpp>
+#include <boost/beast/http/write.hpp>
+#include <boost/system/error_code.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace beast {
+namespace insight {
+
+namespace detail {
+
+class PrometheusCollectorImp;
+
+namespace http = boost::beast::http;
+
+// Upper bounds of the histogram buckets events are counted in, in
+// milliseconds. Anything slower lands in the implicit +Inf bucket.
+constexpr std::array<std::int64_t, 13> bucketBounds{
+    1, 2, 5, 10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000};
+
+// The values of all the metrics sharing a name, gathered for one scrape
+struct PrometheusFamily
+{
+    enum class Type { counter, gauge, histogram };
+
+    Type type;
+    std::uint64_t value = 0;
+    std::array<std::uint64_t, bucketBounds.size() + 1> buckets{};
+    std::int64_t sum = 0;
+};
+
+using PrometheusFamilies = std::map<std::string, PrometheusFamily>;
+
+//------------------------------------------------------------------------------
+
+class PrometheusMetricBase : public List<PrometheusMetricBase>::Node
+{
+public:
+    // Called on a hook before the values are collected
+    virtual void
+    do_process()
+    {
+    }
+
+    // Called on every scrape to add the metric's value
+    virtual void
+    do_collect(PrometheusFamilies&) const
+    {
+    }
+
+    virtual ~PrometheusMetricBase() = default;
+    PrometheusMetricBase() = default;
+    PrometheusMetricBase(PrometheusMetricBase const&) = delete;
+    PrometheusMetricBase&
+    operator=(PrometheusMetricBase const&) = delete;
+
+protected:
+    // Return the family to add to, or nullptr if the name is already taken
+    // by a metric of a different type.
+    static PrometheusFamily*
+    family(
+        PrometheusFamilies& families,
+        std::string const& name,
+        PrometheusFamily::Type type)
+    {
+        auto const [it, inserted] =
+            families.emplace(name, PrometheusFamily{type});
+        if (!inserted && it->second.type != type)
+            return nullptr;
+        return &it->second;
+    }
+};
+
+//------------------------------------------------------------------------------
+
+class PrometheusHookImpl : public HookImpl, public PrometheusMetricBase
+{
+public:
+    PrometheusHookImpl(
+        HandlerType const& handler,
+        std::shared_ptr<PrometheusCollectorImp> const& impl);
+
+    ~PrometheusHookImpl() override;
+
+    void
+    do_process() override;
+
+private:
+    std::shared_ptr<PrometheusCollectorImp> m_impl;
+    HandlerType m_handler;
+};
+
+//------------------------------------------------------------------------------
+
+class PrometheusCounterImpl : public CounterImpl, public PrometheusMetricBase
+{
+public:
+    PrometheusCounterImpl(
+        std::string const& name,
+        std::shared_ptr<PrometheusCollectorImp> const& impl);
+
+    ~PrometheusCounterImpl() override;
+
+    void
+    increment(CounterImpl::value_type amount) override;
+
+    void
+    do_collect(PrometheusFamilies& families) const override;
+
+private:
+    std::shared_ptr<PrometheusCollectorImp> m_impl;
+    std::string m_name;
+    std::atomic<CounterImpl::value_type> m_value{0};
+};
+
+//------------------------------------------------------------------------------
+
+class PrometheusEventImpl : public EventImpl, public PrometheusMetricBase
+{
+public:
+    PrometheusEventImpl(
+        std::string const& name,
+        std::shared_ptr<PrometheusCollectorImp> const& impl);
+
+    ~PrometheusEventImpl() override;
+
+    void
+    notify(EventImpl::value_type const& value) override;
+
+    void
+    do_collect(PrometheusFamilies& families) const override;
+
+private:
+    std::shared_ptr<PrometheusCollectorImp> m_impl;
+    std::string m_name;
+    std::array<std::atomic<std::uint64_t>, bucketBounds.size() + 1>
+        m_buckets{};
+    std::atomic<std::int64_t> m_sum{0};
+};
+
+//------------------------------------------------------------------------------
+
+class PrometheusGaugeImpl : public GaugeImpl, public PrometheusMetricBase
+{
+public:
+    PrometheusGaugeImpl(
+        std::string const& name,
+        std::shared_ptr<PrometheusCollectorImp> const& impl);
+
+    ~PrometheusGaugeImpl() override;
+
+    void
+    set(GaugeImpl::value_type value) override;
+    void
+    increment(GaugeImpl::difference_type amount) override;
+
+    void
+    do_collect(PrometheusFamilies& families) const override;
+
+private:
+    std::shared_ptr<PrometheusCollectorImp> m_impl;
+    std::string m_name;
+    std::atomic<GaugeImpl::value_type> m_value{0};
+};
+
+//------------------------------------------------------------------------------
+
+class PrometheusMeterImpl : public MeterImpl, public PrometheusMetricBase
+{
+public:
+    PrometheusMeterImpl(
+        std::string const& name,
+        std::shared_ptr<PrometheusCollectorImp> const& impl);
+
+    ~PrometheusMeterImpl() override;
+
+    void
+    increment(MeterImpl::value_type amount) override;
+
+    void
+    do_collect(PrometheusFamilies& families) const override;
+
+private:
+    std::shared_ptr<PrometheusCollectorImp> m_impl;
+    std::string m_name;
+    std::atomic<MeterImpl::value_type> m_value{0};
+};
+
+//------------------------------------------------------------------------------
+
+class PrometheusCollectorImp
+    : public PrometheusCollector,
+      public std::enable_shared_from_this<PrometheusCollectorImp>
+{
+private:
+    using tcp = boost::asio::ip::tcp;
+
+    // The most connections served at once. Scrapers keep one connection
+    // open each, so this is plenty, and bounds what a flood can cost.
+    static constexpr std::size_t maxSessions = 16;
+
+    // Hooks are called at most this often, however often we are scraped
+    static constexpr std::chrono::seconds hookInterval{1};
+
+    // Serves the requests made on one connection, one at a time
+    class Session : public std::enable_shared_from_this<Session>
+    {
+    public:
+        Session(PrometheusCollectorImp& impl, tcp::socket&& socket)
+            : m_impl(impl), m_stream(std::move(socket))
+        {
+            ++m_impl.m_sessions;
+        }
+
+        ~Session()
+        {
+            --m_impl.m_sessions;
+        }
+
+        void
+        do_read()
+        {
+            using namespace std::chrono_literals;
+            m_request = {};
+            m_stream.expires_after(30s);
+            http::async_read(
+                m_stream,
+                m_buffer,
+                m_request,
+                [self = shared_from_this()](
+                    boost::system::error_code ec, std::size_t) {
+                    self->on_read(ec);
+                });
+        }
+
+    private:
+        void
+        on_read(boost::system::error_code ec)
+        {
+            if (ec)
+                return;
+
+            m_response = {};
+            m_response.version(m_request.version());
+            m_response.keep_alive(m_request.keep_alive());
+
+            auto const target = m_request.target();
+            auto const path = target.substr(0, target.find('?'));
+            if (path != "/metrics")
+            {
+                m_response.result(http::status::not_found);
+                m_response.set(http::field::content_type, "text/plain");
+                m_response.body() = "Not Found\n";
+            }
+            else if (m_request.method() != http::verb::get)
+            {
+                m_response.result(http::status::method_not_allowed);
+                m_response.set(http::field::allow, "GET");
+                m_response.set(http::field::content_type, "text/plain");
+                m_response.body() = "Method Not Allowed\n";
+            }
+            else
+            {
+                m_response.result(http::status::ok);
+                m_response.set(
+                    http::field::content_type,
+                    "application/openmetrics-text; version=1.0.0; "
+                    "charset=utf-8");
+                m_response.body() = m_impl.render();
+            }
+            m_response.prepare_payload();
+
+            http::async_write(
+                m_stream,
+                m_response,
+                [self = shared_from_this()](
+                    boost::system::error_code ec, std::size_t) {
+                    self->on_write(ec);
+                });
+        }
+
+        void
+        on_write(boost::system::error_code ec)
+        {
+            if (ec)
+                return;
+
+            if (!m_response.need_eof())
+                return do_read();
+
+            m_stream.socket().shutdown(tcp::socket::shutdown_send, ec);
+        }
+
+        PrometheusCollectorImp& m_impl;
+        boost::beast::tcp_stream m_stream;
+        boost::beast::flat_buffer m_buffer;
+        http::request<http::empty_body> m_request;
+        http::response<http::string_body> m_response;
+    };
+
+    Journal m_journal;
+    IP::Endpoint m_address;
+    std::string m_prefix;
+
+    // Only used on the io_service thread. Declared first, so that it
+    // outlives the sessions destroyed along with the io_service.
+    std::size_t m_sessions = 0;
+
+    boost::asio::io_service m_io_service;
+    tcp::acceptor m_acceptor;
+    std::recursive_mutex metricsLock_;
+    List<PrometheusMetricBase> metrics_;
+
+    // Hooks run under their own lock, so a slow hook does not hold up
+    // the creation of metrics elsewhere
+    std::recursive_mutex hooksLock_;
+    List<PrometheusMetricBase> hooks_;
+    std::chrono::steady_clock::time_point nextHooks_;
+
+    // Started once the acceptor is listening
+    std::thread m_thread;
+
+public:
+    PrometheusCollectorImp(
+        IP::Endpoint const& address,
+        std::string const& prefix,
+        Journal journal)
+        : m_journal(journal)
+        , m_address(address)
+        , m_prefix(prefix)
+        , m_acceptor(m_io_service)
+    {
+        // Listen before returning, so that the port is known and a
+        // scrape cannot be refused while the thread starts
+        listen();
+        m_thread = std::thread(&PrometheusCollectorImp::run, this);
+    }
+
+    ~PrometheusCollectorImp() override
+    {
+        // Connections still open are dropped along with their handlers
+        m_io_service.stop();
+        m_thread.join();
+    }
+
+    Hook
+    make_hook(HookImpl::HandlerType const& handler) override
+    {
+        return Hook(std::make_shared<detail::PrometheusHookImpl>(
+            handler, shared_from_this()));
+    }
+
+    Counter
+    make_counter(std::string const& name) override
+    {
+        return Counter(std::make_shared<detail::PrometheusCounterImpl>(
+            name, shared_from_this()));
+    }
+
+    Event
+    make_event(std::string const& name) override
+    {
+        return Event(std::make_shared<detail::PrometheusEventImpl>(
+            name, shared_from_this()));
+    }
+
+    Gauge
+    make_gauge(std::string const& name) override
+    {
+        return Gauge(std::make_shared<detail::PrometheusGaugeImpl>(
+            name, shared_from_this()));
+    }
+
+    Meter
+    make_meter(std::string const& name) override
+    {
+        return Meter(std::make_shared<detail::PrometheusMeterImpl>(
+            name, shared_from_this()));
+    }
+
+    //--------------------------------------------------------------------------
+
+    void
+    add(PrometheusMetricBase& metric)
+    {
+        std::lock_guard _(metricsLock_);
+        metrics_.push_back(metric);
+    }
+
+    void
+    remove(PrometheusMetricBase& metric)
+    {
+        std::lock_guard _(metricsLock_);
+        metrics_.erase(metrics_.iterator_to(metric));
+    }
+
+    void
+    add_hook(PrometheusMetricBase& hook)
+    {
+        std::lock_guard _(hooksLock_);
+        hooks_.push_back(hook);
+    }
+
+    void
+    remove_hook(PrometheusMetricBase& hook)
+    {
+        std::lock_guard _(hooksLock_);
+        hooks_.erase(hooks_.iterator_to(hook));
+    }
+
+    /** Return the name a metric is exposed as.
+
+        The prefix is prepended, and the characters that may not appear in
+        a metric name, such as the dots separating groups, are replaced.
+    */
+    std::string
+    metric_name(std::string const& name) const
+    {
+        std::string result = m_prefix.empty() ? name : m_prefix + "_" + name;
+        for (auto& c : result)
+        {
+            if (!(c >= 'a' && c <= 'z') && !(c >= 'A' && c <= 'Z') &&
+                !(c >= '0' && c <= '9') && c != '_' && c != ':')
+                c = '_';
+        }
+        if (result.empty() || (result[0] >= '0' && result[0] <= '9'))
+            result.insert(result.begin(), '_');
+        return result;
+    }
+
+    /** Return the name a counter is exposed as.
+
+        The samples of a counter get the `_total` suffix, so the name of
+        the counter itself must not have it.
+    */
+    std::string
+    counter_name(std::string const& name) const
+    {
+        auto result = metric_name(name);
+        if (result.size() > 6 && result.ends_with("_total"))
+            result.resize(result.size() - 6);
+        return result;
+    }
+
+    //--------------------------------------------------------------------------
+
+    IP::Endpoint
+    local_endpoint() const override
+    {
+        boost::system::error_code ec;
+        auto const endpoint = m_acceptor.local_endpoint(ec);
+        if (ec)
+            return {};
+        return IPAddressConversion::from_asio(endpoint);
+    }
+
+    // Call the hooks, unless they were called within the last interval
+    void
+    process_hooks()
+    {
+        std::lock_guard _(hooksLock_);
+        auto const now = std::chrono::steady_clock::now();
+        if (now < nextHooks_)
+            return;
+        nextHooks_ = now + hookInterval;
+        for (auto& hook : hooks_)
+            hook.do_process();
+    }
+
+    std::string
+    render() override
+    {
+        process_hooks();
+
+        PrometheusFamilies families;
+        {
+            std::lock_guard _(metricsLock_);
+            for (auto const& m : metrics_)
+                m.do_collect(families);
+        }
+
+        std::string out;
+        out.reserve(families.size() * 64);
+        for (auto const& [name, family] : families)
+        {
+            switch (family.type)
+            {
+                case PrometheusFamily::Type::counter:
+                    out += "# TYPE " + name + " counter\n";
+                    out += name + "_total " + std::to_string(family.value) +
+                        "\n";
+                    break;
+                case PrometheusFamily::Type::gauge:
+                    out += "# TYPE " + name + " gauge\n";
+                    out += name + " " + std::to_string(family.value) + "\n";
+                    break;
+                case PrometheusFamily::Type::histogram: {
+                    out += "# TYPE " + name + " histogram\n";
+                    std::uint64_t count = 0;
+                    for (std::size_t i = 0; i < family.buckets.size(); ++i)
+                    {
+                        count += family.buckets[i];
+                        auto const le = i < bucketBounds.size()
+                            ? std::to_string(bucketBounds[i]) + ".0"
+                            : std::string("+Inf");
+                        out += name + "_bucket{le=\"" + le + "\"} " +
+                            std::to_string(count) + "\n";
+                    }
+                    out += name + "_count " + std::to_string(count) + "\n";
+                    out += name + "_sum " + std::to_string(family.sum) + "\n";
+                    break;
+                }
+            }
+        }
+        out += "# EOF\n";
+        return out;
+    }
+
+    //--------------------------------------------------------------------------
+
+    void
+    do_accept()
+    {
+        m_acceptor.async_accept(
+            [this](boost::system::error_code ec, tcp::socket socket) {
+                on_accept(ec, std::move(socket));
+            });
+    }
+
+    void
+    on_accept(boost::system::error_code ec, tcp::socket socket)
+    {
+        if (ec == boost::asio::error::operation_aborted)
+            return;
+
+        if (ec)
+        {
+            if (auto stream = m_journal.warn())
+                stream << "async_accept failed: " << ec.message();
+        }
+        else if (m_sessions >= maxSessions)
+        {
+            if (auto stream = m_journal.debug())
+                stream << "Refusing connection: " << maxSessions
+                       << " already open";
+            socket.close(ec);
+        }
+        else
+        {
+            std::make_shared<Session>(*this, std::move(socket))->do_read();
+        }
+
+        do_accept();
+    }
+
+    void
+    listen()
+    {
+        boost::system::error_code ec;
+        tcp::endpoint const endpoint(m_address.address(), m_address.port());
+
+        m_acceptor.open(endpoint.protocol(), ec);
+        if (!ec)
+            m_acceptor.set_option(tcp::acceptor::reuse_address(true), ec);
+        if (!ec)
+            m_acceptor.bind(endpoint, ec);
+        if (!ec)
+            m_acceptor.listen(
+                boost::asio::socket_base::max_listen_connections, ec);
+        if (ec)
+        {
+            if (auto stream = m_journal.error())
+                stream << "Listen on " << m_address
+                       << " failed: " << ec.message();
+            m_acceptor.close(ec);
+            return;
+        }
+
+        if (auto stream = m_journal.info())
+            stream << "Serving metrics on " << local_endpoint();
+    }
+
+    void
+    run()
+    {
+        if (!m_acceptor.is_open())
+            return;
+
+        do_accept();
+
+        m_io_service.run();
+    }
+};
+
+//------------------------------------------------------------------------------
+
+PrometheusHookImpl::PrometheusHookImpl(
+    HandlerType const& handler,
+    std::shared_ptr<PrometheusCollectorImp> const& impl)
+    : m_impl(impl), m_handler(handler)
+{
+    m_impl->add_hook(*this);
+}
+
+PrometheusHookImpl::~PrometheusHookImpl()
+{
+    m_impl->remove_hook(*this);
+}
+
+void
+PrometheusHookImpl::do_process()
+{
+    m_handler();
+}
+
+//------------------------------------------------------------------------------
+
+PrometheusCounterImpl::PrometheusCounterImpl(
+    std::string const& name,
+    std::shared_ptr<PrometheusCollectorImp> const& impl)
+    : m_impl(impl), m_name(impl->counter_name(name))
+{
+    m_impl->add(*this);
+}
+
+PrometheusCounterImpl::~PrometheusCounterImpl()
+{
+    m_impl->remove(*this);
+}
+
+void
+PrometheusCounterImpl::increment(CounterImpl::value_type amount)
+{
+    m_value.fetch_add(amount, std::memory_order_relaxed);
+}
+
+void
+PrometheusCounterImpl::do_collect(PrometheusFamilies& families) const
+{
+    if (auto f = family(families, m_name, PrometheusFamily::Type::counter))
+        f->value += std::max<CounterImpl::value_type>(
+            m_value.load(std::memory_order_relaxed), 0);
+}
+
+//------------------------------------------------------------------------------
+
+PrometheusEventImpl::PrometheusEventImpl(
+    std::string const& name,
+    std::shared_ptr<PrometheusCollectorImp> const& impl)
+    : m_impl(impl), m_name(impl->metric_name(name))
+{
+    m_impl->add(*this);
+}
+
+PrometheusEventImpl::~PrometheusEventImpl()
+{
+    m_impl->remove(*this);
+}
+
+void
+PrometheusEventImpl::notify(EventImpl::value_type const& value)
+{
+    auto const ms = value.count();
+    auto const bucket =
+        std::lower_bound(bucketBounds.begin(), bucketBounds.end(), ms) -
+        bucketBounds.begin();
+    m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    m_sum.fetch_add(ms, std::memory_order_relaxed);
+}
+
+void
+PrometheusEventImpl::do_collect(PrometheusFamilies& families) const
+{
+    auto f = family(families, m_name, PrometheusFamily::Type::histogram);
+    if (!f)
+        return;
+
+    for (std::size_t i = 0; i < m_buckets.size(); ++i)
+        f->buckets[i] += m_buckets[i].load(std::memory_order_relaxed);
+    f->sum += m_sum.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+
+PrometheusGaugeImpl::PrometheusGaugeImpl(
+    std::string const& name,
+    std::shared_ptr<PrometheusCollectorImp> const& impl)
+    : m_impl(impl), m_name(impl->metric_name(name))
+{
+    m_impl->add(*this);
+}
+
+PrometheusGaugeImpl::~PrometheusGaugeImpl()
+{
+    m_impl->remove(*this);
+}
+
+void
+PrometheusGaugeImpl::set(GaugeImpl::value_type value)
+{
+    m_value.store(value, std::memory_order_relaxed);
+}
+
+void
+PrometheusGaugeImpl::increment(GaugeImpl::difference_type amount)
+{
+    // Saturate at the limits of the value type, like the StatsD gauge
+    auto value = m_value.load(std::memory_order_relaxed);
+    GaugeImpl::value_type next;
+    do
+    {
+        next = value;
+        if (amount > 0)
+        {
+            GaugeImpl::value_type const d(
+                static_cast<GaugeImpl::value_type>(amount));
+            auto const room =
+                std::numeric_limits<GaugeImpl::value_type>::max() - value;
+            next += (d >= room) ? room : d;
+        }
+        else if (amount < 0)
+        {
+            GaugeImpl::value_type const d(
+                static_cast<GaugeImpl::value_type>(-amount));
+            next = (d >= value) ? 0 : value - d;
+        }
+    } while (!m_value.compare_exchange_weak(
+        value, next, std::memory_order_relaxed));
+}
+
+void
+PrometheusGaugeImpl::do_collect(PrometheusFamilies& families) const
+{
+    if (auto f = family(families, m_name, PrometheusFamily::Type::gauge))
+        f->value += m_value.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+
+PrometheusMeterImpl::PrometheusMeterImpl(
+    std::string const& name,
+    std::shared_ptr<PrometheusCollectorImp> const& impl)
+    : m_impl(impl), m_name(impl->counter_name(name))
+{
+    m_impl->add(*this);
+}
+
+PrometheusMeterImpl::~PrometheusMeterImpl()
+{
+    m_impl->remove(*this);
+}
+
+void
+PrometheusMeterImpl::increment(MeterImpl::value_type amount)
+{
+    m_value.fetch_add(amount, std::memory_order_relaxed);
+}
+
+void
+PrometheusMeterImpl::do_collect(PrometheusFamilies& families) const
+{
+    if (auto f = family(families, m_name, PrometheusFamily::Type::counter))
+        f->value += m_value.load(std::memory_order_relaxed);
+}
+
+}  // namespace detail
+
+//------------------------------------------------------------------------------
+
+std::shared_ptr<PrometheusCollector>
+PrometheusCollector::New(
+    IP::Endpoint const& address,
+    std::string const& prefix,
+    Journal journal)
+{
+    return std::make_shared<detail::PrometheusCollectorImp>(
+        address, prefix, journal);
+}
+
+}  // namespace insight
+}  // namespace beast
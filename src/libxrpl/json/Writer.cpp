@@ -22,7 +22,6 @@
 #include <xrpl/json/Writer.h>
 
 #include <cstddef>
-#include <map>
 #include <memory>
 #include <set>
 #include <stack>
@@ -34,15 +33,33 @@ namespace Json {
 
 namespace {
 
-std::map<char, char const*> jsonSpecialCharacterEscape = {
-    {'"', "\\\""},
-    {'\\', "\\\\"},
-    {'/', "\\/"},
-    {'\b', "\\b"},
-    {'\f', "\\f"},
-    {'\n', "\\n"},
-    {'\r', "\\r"},
-    {'\t', "\\t"}};
+// Called once per output byte, so this is a switch rather than a lookup in
+// a node-based container.
+char const*
+jsonSpecialCharacterEscape(char c)
+{
+    switch (c)
+    {
+        case '"':
+            return "\\\"";
+        case '\\':
+            return "\\\\";
+        case '/':
+            return "\\/";
+        case '\b':
+            return "\\b";
+        case '\f':
+            return "\\f";
+        case '\n':
+            return "\\n";
+        case '\r':
+            return "\\r";
+        case '\t':
+            return "\\t";
+        default:
+            return nullptr;
+    }
+}
 
 static size_t const jsonEscapeLength = 2;
 
@@ -122,14 +139,14 @@ public:
         auto data = bytes.data();
         for (; position < bytes.size(); ++position)
         {
-            auto i = jsonSpecialCharacterEscape.find(data[position]);
-            if (i != jsonSpecialCharacterEscape.end())
+            auto const escape = jsonSpecialCharacterEscape(data[position]);
+            if (escape)
             {
                 if (writtenUntil < position)
                 {
                     output_({data + writtenUntil, position - writtenUntil});
                 }
-                output_({i->second, jsonEscapeLength});
+                output_({escape, jsonEscapeLength});
                 writtenUntil = position + 1;
             };
         }
@@ -146,17 +163,20 @@ public:
     }
 
     void
-    nextCollectionEntry(CollectionType type, std::string const& message)
+    nextCollectionEntry(CollectionType type, char const* message)
     {
-        check(!empty(), "empty () in " + message);
+        // Only build the diagnostic when it is needed: this is called for
+        // every element written.
+        if (empty())
+            check(false, std::string("empty () in ") + message);
 
         auto t = stack_.top().type;
         if (t != type)
         {
             check(
                 false,
-                "Not an " +
-                    ((type == array ? "array: " : "object: ") + message));
+                std::string("Not an ") +
+                    (type == array ? "array: " : "object: ") + message);
         }
         if (stack_.top().isFirst)
             stack_.top().isFirst = false;
@@ -401,19 +401,30 @@ Reader::readNumber()
 bool
 Reader::readString()
 {
-    Char c = 0;
-
+    // Rather than stepping through the string a character at a time, jump
+    // from one quote to the next with memchr (which the C library vectorizes)
+    // and decide whether each quote is escaped by counting the backslashes
+    // immediately before it. The opening quote bounds that count.
     while (current_ != end_)
     {
-        c = getNextChar();
+        auto const quote = static_cast<Location>(
+            std::memchr(current_, '"', end_ - current_));
 
-        if (c == '\\')
-            getNextChar();
-        else if (c == '"')
+        if (!quote)
             break;
+
+        current_ = quote + 1;
+
+        Location backslash = quote;
+        while (backslash[-1] == '\\')
+            --backslash;
+
+        if ((quote - backslash) % 2 == 0)
+            return true;
     }
 
-    return c == '"';
+    current_ = end_;
+    return false;
 }
 
 bool
@@ -452,11 +463,13 @@ Reader::readObject(Token& tokenStart, unsigned depth)
                 "Missing ':' after object member name", colon, tokenObjectEnd);
         }
 
-        // Reject duplicate names
-        if (currentValue().isMember(name))
+        // Reject duplicate names. Detect them by whether the lookup added a
+        // member, so that each name is only searched for once.
+        auto const members = currentValue().size();
+        Value& value = currentValue()[name];
+        if (currentValue().size() == members)
             return addError("Key '" + name + "' appears twice.", tokenName);
 
-        Value& value = currentValue()[name];
         nodes_.push(&value);
         bool ok = readValue(depth + 1);
         nodes_.pop();
@@ -502,11 +515,9 @@ Reader::readArray(Token& tokenStart, unsigned depth)
         return true;
     }
 
-    int index = 0;
-
     while (true)
     {
-        Value& value = currentValue()[index++];
+        Value& value = currentValue().append(Value());
         nodes_.push(&value);
         bool ok = readValue(depth + 1);
         nodes_.pop();
@@ -684,6 +695,16 @@ Reader::decodeString(Token& token, std::string& decoded)
 
     while (current != end)
     {
+        // Copy everything up to the next escape in one go
+        auto const run = std::find_if(current, end, [](Char c) {
+            return c == '"' || c == '\\';
+        });
+        decoded.append(current, run);
+        current = run;
+
+        if (current == end)
+            break;
+
         Char c = *current++;
 
         if (c == '"')
@@ -745,10 +766,6 @@ Reader::decodeString(Token& token, std::string& decoded)
                         "Bad escape sequence in string", token, current);
             }
         }
-        else
-        {
-            decoded += c;
-        }
     }
 
     return true;
@@ -260,7 +260,7 @@ Value::Value(bool value) : type_(booleanValue)
     value_.bool_ = value;
 }
 
-Value::Value(Value const& other) : type_(other.type_)
+Value::Value(Value const& other) : type_(other.type_), allocated_(0)
 {
     switch (type_)
     {
@@ -286,7 +286,14 @@ Value::Value(Value const& other) : type_(other.type_)
 
         case arrayValue:
         case objectValue:
-            value_.map_ = new ObjectValues(*other.value_.map_);
+            if (other.allocated_)
+            {
+                value_.shared_ =
+                    new std::shared_ptr<Value const>(*other.value_.shared_);
+                allocated_ = true;
+            }
+            else
+                value_.map_ = new ObjectValues(*other.value_.map_);
             break;
 
         // LCOV_EXCL_START
@@ -315,7 +322,9 @@ Value::~Value()
 
         case arrayValue:
         case objectValue:
-            if (value_.map_)
+            if (allocated_)
+                delete value_.shared_;
+            else if (value_.map_)
                 delete value_.map_;
             break;
 
@@ -326,6 +335,57 @@ Value::~Value()
     }
 }
 
+Value
+Value::share(std::shared_ptr<Value const> value)
+{
+    if (!value)
+        return Value();
+    // A value that is itself shared is copied, sharing what it shares
+    if ((!value->isArray() && !value->isObject()) || value->allocated_)
+        return *value;
+
+    Value result(nullValue);
+    auto const type = value->type_;
+    result.value_.shared_ = new std::shared_ptr<Value const>(std::move(value));
+    result.type_ = type;
+    result.allocated_ = true;
+    return result;
+}
+
+bool
+Value::hasMap() const
+{
+    return allocated_ || value_.map_;
+}
+
+Value::ObjectValues const&
+Value::map() const
+{
+    return allocated_ ? (*value_.shared_)->map() : *value_.map_;
+}
+
+Value::ObjectValues&
+Value::ownMap()
+{
+    if (allocated_)
+    {
+        // Copy the elements of the shared value before the first change.
+        // The arrays and objects among them share their own elements in
+        // turn, so only the part of the tree that changes is ever copied.
+        auto const shared = value_.shared_;
+        auto values = std::make_unique<ObjectValues>();
+        for (auto const& [key, value] : (*shared)->map())
+            values->emplace_hint(
+                values->end(),
+                key,
+                share(std::shared_ptr<Value const>(*shared, &value)));
+        value_.map_ = values.release();
+        allocated_ = false;
+        delete shared;
+    }
+    return *value_.map_;
+}
+
 Value&
 Value::operator=(Value const& other)
 {
@@ -416,10 +476,10 @@ operator<(Value const& x, Value const& y)
 
         case arrayValue:
         case objectValue: {
-            if (int signum = int(x.value_.map_->size()) - y.value_.map_->size())
+            if (int signum = int(x.map().size()) - y.map().size())
                 return signum < 0;
 
-            return *x.value_.map_ < *y.value_.map_;
+            return x.map() < y.map();
         }
 
             // LCOV_EXCL_START
@@ -467,8 +527,7 @@ operator==(Value const& x, Value const& y)
 
         case arrayValue:
         case objectValue:
-            return x.value_.map_->size() == y.value_.map_->size() &&
-                *x.value_.map_ == *y.value_.map_;
+            return x.map().size() == y.map().size() && x.map() == y.map();
 
         // LCOV_EXCL_START
         default:
@@ -730,7 +789,7 @@ Value::asBool() const
 
         case arrayValue:
         case objectValue:
-            return value_.map_->size() != 0;
+            return map().size() != 0;
 
             // LCOV_EXCL_START
         default:
@@ -784,11 +843,11 @@ Value::isConvertibleTo(ValueType other) const
 
         case arrayValue:
             return other == arrayValue ||
-                (other == nullValue && value_.map_->size() == 0);
+                (other == nullValue && map().size() == 0);
 
         case objectValue:
             return other == objectValue ||
-                (other == nullValue && value_.map_->size() == 0);
+                (other == nullValue && map().size() == 0);
 
         // LCOV_EXCL_START
         default:
@@ -814,9 +873,9 @@ Value::size() const
             return 0;
 
         case arrayValue:  // size of the array is highest index + 1
-            if (!value_.map_->empty())
+            if (!map().empty())
             {
-                ObjectValues::const_iterator itLast = value_.map_->end();
+                ObjectValues::const_iterator itLast = map().end();
                 --itLast;
                 return (*itLast).first.index() + 1;
             }
@@ -824,7 +883,7 @@ Value::size() const
             return 0;
 
         case objectValue:
-            return Int(value_.map_->size());
+            return Int(map().size());
 
             // LCOV_EXCL_START
         default:
@@ -860,7 +919,7 @@ Value::clear()
     {
         case arrayValue:
         case objectValue:
-            value_.map_->clear();
+            ownMap().clear();
             break;
 
         default:
@@ -879,13 +938,14 @@ Value::operator[](UInt index)
         *this = Value(arrayValue);
 
     CZString key(index);
-    ObjectValues::iterator it = value_.map_->lower_bound(key);
+    auto& values = ownMap();
+    ObjectValues::iterator it = values.lower_bound(key);
 
-    if (it != value_.map_->end() && (*it).first == key)
+    if (it != values.end() && (*it).first == key)
         return (*it).second;
 
     ObjectValues::value_type defaultValue(key, null);
-    it = value_.map_->insert(it, defaultValue);
+    it = values.insert(it, defaultValue);
     return (*it).second;
 }
 
@@ -900,9 +960,9 @@ Value::operator[](UInt index) const
         return null;
 
     CZString key(index);
-    ObjectValues::const_iterator it = value_.map_->find(key);
+    ObjectValues::const_iterator it = map().find(key);
 
-    if (it == value_.map_->end())
+    if (it == map().end())
         return null;
 
     return (*it).second;
@@ -926,13 +986,14 @@ Value::resolveReference(char const* key, bool isStatic)
 
     CZString actualKey(
         key, isStatic ? CZString::noDuplication : CZString::duplicateOnCopy);
-    ObjectValues::iterator it = value_.map_->lower_bound(actualKey);
+    auto& values = ownMap();
+    ObjectValues::iterator it = values.lower_bound(actualKey);
 
-    if (it != value_.map_->end() && (*it).first == actualKey)
+    if (it != values.end() && (*it).first == actualKey)
         return (*it).second;
 
     ObjectValues::value_type defaultValue(actualKey, null);
-    it = value_.map_->insert(it, defaultValue);
+    it = values.insert(it, defaultValue);
     Value& value = (*it).second;
     return value;
 }
@@ -961,9 +1022,9 @@ Value::operator[](char const* key) const
         return null;
 
     CZString actualKey(key, CZString::noDuplication);
-    ObjectValues::const_iterator it = value_.map_->find(actualKey);
+    ObjectValues::const_iterator it = map().find(actualKey);
 
-    if (it == value_.map_->end())
+    if (it == map().end())
         return null;
 
     return (*it).second;
@@ -996,13 +1057,26 @@ Value::operator[](StaticString const& key) const
 Value&
 Value::append(Value const& value)
 {
-    return (*this)[size()] = value;
+    return append(Value(value));
 }
 
 Value&
 Value::append(Value&& value)
 {
-    return (*this)[size()] = std::move(value);
+    XRPL_ASSERT(
+        type_ == nullValue || type_ == arrayValue,
+        "Json::Value::append : valid type");
+
+    if (type_ == nullValue)
+        *this = Value(arrayValue);
+
+    // Indices are ordered, so the new element always belongs at the end of
+    // the map: construct it there directly rather than inserting a null and
+    // assigning over it.
+    auto& values = ownMap();
+    auto const it =
+        values.emplace_hint(values.end(), CZString(size()), std::move(value));
+    return it->second;
 }
 
 Value
@@ -1029,13 +1103,14 @@ Value::removeMember(char const* key)
         return null;
 
     CZString actualKey(key, CZString::noDuplication);
-    ObjectValues::iterator it = value_.map_->find(actualKey);
+    auto& values = ownMap();
+    ObjectValues::iterator it = values.find(actualKey);
 
-    if (it == value_.map_->end())
+    if (it == values.end())
         return null;
 
     Value old(it->second);
-    value_.map_->erase(it);
+    values.erase(it);
     return old;
 }
 
@@ -1078,9 +1153,9 @@ Value::getMemberNames() const
         return Value::Members();
 
     Members members;
-    members.reserve(value_.map_->size());
-    ObjectValues::const_iterator it = value_.map_->begin();
-    ObjectValues::const_iterator itEnd = value_.map_->end();
+    members.reserve(map().size());
+    ObjectValues::const_iterator it = map().begin();
+    ObjectValues::const_iterator itEnd = map().end();
 
     for (; it != itEnd; ++it)
         members.push_back(std::string((*it).first.c_str()));
@@ -1174,8 +1249,10 @@ Value::begin() const
     {
         case arrayValue:
         case objectValue:
-            if (value_.map_)
-                return const_iterator(value_.map_->begin());
+            // The iterator only reads through the map
+            if (hasMap())
+                return const_iterator(
+                    const_cast<ObjectValues&>(map()).begin());
 
             break;
         default:
@@ -1192,8 +1269,8 @@ Value::end() const
     {
         case arrayValue:
         case objectValue:
-            if (value_.map_)
-                return const_iterator(value_.map_->end());
+            if (hasMap())
+                return const_iterator(const_cast<ObjectValues&>(map()).end());
 
             break;
         default:
@@ -1210,8 +1287,8 @@ Value::begin()
     {
         case arrayValue:
         case objectValue:
-            if (value_.map_)
-                return iterator(value_.map_->begin());
+            if (hasMap())
+                return iterator(ownMap().begin());
             break;
         default:
             break;
@@ -1227,8 +1304,8 @@ Value::end()
     {
         case arrayValue:
         case objectValue:
-            if (value_.map_)
-                return iterator(value_.map_->end());
+            if (hasMap())
+                return iterator(ownMap().end());
             break;
         default:
             break;
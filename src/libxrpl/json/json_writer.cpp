@@ -116,52 +116,52 @@ valueToString(bool value)
     return value ? "true" : "false";
 }
 
-std::string
-valueToQuotedString(char const* value)
+static void
+appendQuotedString(std::string& out, char const* value)
 {
+    out += '"';
+
     // Not sure how to handle unicode...
     if (strpbrk(value, "\"\\\b\f\n\r\t") == nullptr &&
         !containsControlCharacter(value))
-        return std::string("\"") + value + "\"";
+    {
+        out += value;
+        out += '"';
+        return;
+    }
 
     // We have to walk value and escape any special characters.
-    // Appending to std::string is not efficient, but this should be rare.
     // (Note: forward slashes are *not* rare, but I am not escaping them.)
-    unsigned maxsize = strlen(value) * 2 + 3;  // allescaped+quotes+NULL
-    std::string result;
-    result.reserve(maxsize);  // to avoid lots of mallocs
-    result += "\"";
-
     for (char const* c = value; *c != 0; ++c)
     {
         switch (*c)
         {
             case '\"':
-                result += "\\\"";
+                out += "\\\"";
                 break;
 
             case '\\':
-                result += "\\\\";
+                out += "\\\\";
                 break;
 
             case '\b':
-                result += "\\b";
+                out += "\\b";
                 break;
 
             case '\f':
-                result += "\\f";
+                out += "\\f";
                 break;
 
             case '\n':
-                result += "\\n";
+                out += "\\n";
                 break;
 
             case '\r':
-                result += "\\r";
+                out += "\\r";
                 break;
 
             case '\t':
-                result += "\\t";
+                out += "\\t";
                 break;
 
                 // case '/':
@@ -178,18 +178,25 @@ valueToQuotedString(char const* value)
                     oss << "\\u" << std::hex << std::uppercase
                         << std::setfill('0') << std::setw(4)
                         << static_cast<int>(*c);
-                    result += oss.str();
+                    out += oss.str();
                 }
                 else
                 {
-                    result += *c;
+                    out += *c;
                 }
 
                 break;
         }
     }
 
-    result += "\"";
+    out += '"';
+}
+
+std::string
+valueToQuotedString(char const* value)
+{
+    std::string result;
+    appendQuotedString(result, value);
     return result;
 }
 
@@ -226,7 +233,7 @@ FastWriter::writeValue(Value const& value)
             break;
 
         case stringValue:
-            document_ += valueToQuotedString(value.asCString());
+            appendQuotedString(document_, value.asCString());
             break;
 
         case booleanValue:
@@ -235,14 +242,18 @@ FastWriter::writeValue(Value const& value)
 
         case arrayValue: {
             document_ += "[";
-            int size = value.size();
+            UInt index = 0;
 
-            for (int index = 0; index < size; ++index)
+            for (auto it = value.begin(); it != value.end(); ++it)
             {
-                if (index > 0)
+                // Elements missing from a sparse array are written as null.
+                for (; index < it.index(); ++index)
+                    document_ += index > 0 ? ",null" : "null";
+
+                if (index++ > 0)
                     document_ += ",";
 
-                writeValue(value[index]);
+                writeValue(*it);
             }
 
             document_ += "]";
@@ -250,21 +261,16 @@ FastWriter::writeValue(Value const& value)
         break;
 
         case objectValue: {
-            Value::Members members(value.getMemberNames());
             document_ += "{";
 
-            for (Value::Members::iterator it = members.begin();
-                 it != members.end();
-                 ++it)
+            for (auto it = value.begin(); it != value.end(); ++it)
             {
-                std::string const& name = *it;
-
-                if (it != members.begin())
+                if (it != value.begin())
                     document_ += ",";
 
-                document_ += valueToQuotedString(name.c_str());
+                appendQuotedString(document_, it.memberName());
                 document_ += ":";
-                writeValue(value[name]);
+                writeValue(*it);
             }
 
             document_ += "}";
@@ -273,6 +279,100 @@ FastWriter::writeValue(Value const& value)
     }
 }
 
+// Class IncrementalWriter
+// //////////////////////////////////////////////////////////////////
+
+IncrementalWriter::IncrementalWriter(Value const& root) : next_(&root)
+{
+}
+
+bool
+IncrementalWriter::write(std::string& out, std::size_t bytes)
+{
+    auto const start = out.size();
+
+    while ((next_ || !stack_.empty()) && out.size() - start < bytes)
+    {
+        if (next_)
+        {
+            Value const& value = *next_;
+            next_ = nullptr;
+
+            switch (value.type())
+            {
+                case nullValue:
+                    out += "null";
+                    break;
+
+                case intValue:
+                    out += valueToString(value.asInt());
+                    break;
+
+                case uintValue:
+                    out += valueToString(value.asUInt());
+                    break;
+
+                case realValue:
+                    out += valueToString(value.asDouble());
+                    break;
+
+                case stringValue:
+                    appendQuotedString(out, value.asCString());
+                    break;
+
+                case booleanValue:
+                    out += valueToString(value.asBool());
+                    break;
+
+                case arrayValue:
+                    out += '[';
+                    stack_.push_back({&value, {}});
+                    break;
+
+                case objectValue:
+                    out += '{';
+                    stack_.push_back({&value, value.begin()});
+                    break;
+            }
+            continue;
+        }
+
+        auto& frame = stack_.back();
+        bool const isObject = frame.value->isObject();
+
+        // Arrays are walked by index, like FastWriter, so that missing
+        // elements of a sparse array are written as null.
+        if (isObject ? frame.it == frame.value->end()
+                     : frame.index == frame.value->size())
+        {
+            out += isObject ? '}' : ']';
+            stack_.pop_back();
+            continue;
+        }
+
+        if (!frame.first)
+            out += ',';
+        frame.first = false;
+
+        if (isObject)
+        {
+            appendQuotedString(out, frame.it.memberName());
+            out += ':';
+            next_ = &*frame.it;
+            ++frame.it;
+        }
+        else
+        {
+            next_ = &(*frame.value)[frame.index++];
+        }
+    }
+
+    if (!next_ && stack_.empty())
+        complete_ = true;
+
+    return complete_;
+}
+
 // Class StyledWriter
 // //////////////////////////////////////////////////////////////////
 
@@ -24,6 +24,8 @@
 #include <xrpl/protocol/SystemParameters.h>
 #include <xrpl/server/detail/JSONRPCUtil.h>
 
+#include <cstdio>
+#include <cstring>
 #include <ctime>
 #include <string>
 
@@ -97,6 +99,17 @@ HTTPReply(
         return;
     }
 
+    HTTPReplyHeaders(nStatus, content.size() + 2, output);
+    output(content);
+    output("\r\n");
+}
+
+void
+HTTPReplyHeaders(
+    int nStatus,
+    std::optional<std::size_t> contentLength,
+    Json::Output const& output)
+{
     switch (nStatus)
     {
         case 200:
@@ -136,26 +149,128 @@ HTTPReply(
 
     output(getHTTPHeaderTimestamp());
 
-    output(
-        "Connection: Keep-Alive\r\n"
-        "Content-Length: ");
+    output("Connection: Keep-Alive\r\n");
 
     // VFALCO TODO Determine if/when this header should be added
     // if (context.app.config().RPC_ALLOW_REMOTE)
     //    output ("Access-Control-Allow-Origin: *\r\n");
 
-    output(std::to_string(content.size() + 2));
-    output(
-        "\r\n"
-        "Content-Type: application/json; charset=UTF-8\r\n");
+    if (contentLength)
+    {
+        output("Content-Length: ");
+        output(std::to_string(*contentLength));
+        output("\r\n");
+    }
+    else
+    {
+        output("Transfer-Encoding: chunked\r\n");
+    }
+    output("Content-Type: application/json; charset=UTF-8\r\n");
 
     output("Server: " + systemName() + "-json-rpc/");
     output(BuildInfo::getFullVersionString());
     output(
         "\r\n"
         "\r\n");
-    output(content);
-    output("\r\n");
+}
+
+//------------------------------------------------------------------------------
+
+JsonReplyWriter::JsonReplyWriter(
+    int nStatus,
+    Json::Value&& reply,
+    bool chunked,
+    std::function<void(std::size_t)> onComplete)
+    : reply_(std::move(reply))
+    , writer_(reply_)
+    , onComplete_(std::move(onComplete))
+{
+    std::string body;
+    if (chunked)
+        writer_.write(body, chunkSize);
+    else
+        while (!writer_.write(body, chunkSize))
+            ;
+
+    if (!writer_.complete())
+    {
+        HTTPReplyHeaders(nStatus, std::nullopt, Json::stringOutput(buf_));
+        appendChunk(body);
+        return;
+    }
+
+    // Keep the body byte-for-byte identical to what HTTPReply sends.
+    payloadSize_ = body.size();
+    body += "\n\r\n";
+    HTTPReplyHeaders(nStatus, body.size(), Json::stringOutput(buf_));
+    buf_ += body;
+    finish();
+}
+
+void
+JsonReplyWriter::appendChunk(std::string_view piece)
+{
+    // Leading zeros are allowed in a chunk size, so reserve a fixed width
+    // field and fill it in once the size of the chunk is known.
+    auto const header = buf_.size();
+    buf_.append("00000000\r\n");
+    auto const start = buf_.size();
+    buf_.append(piece);
+    if (piece.empty())
+        writer_.write(buf_, chunkSize);
+    payloadSize_ += buf_.size() - start;
+    if (writer_.complete())
+        buf_ += "\n\r\n";
+
+    auto const n = buf_.size() - start;
+    char hex[9];
+    std::snprintf(hex, sizeof(hex), "%08zx", n);
+    std::memcpy(&buf_[header], hex, 8);
+    buf_ += "\r\n";
+
+    if (writer_.complete())
+    {
+        buf_ += "0\r\n\r\n";
+        finish();
+    }
+}
+
+void
+JsonReplyWriter::finish()
+{
+    last_ = true;
+    if (onComplete_)
+        onComplete_(payloadSize_);
+}
+
+bool
+JsonReplyWriter::complete()
+{
+    return last_ && pos_ == buf_.size();
+}
+
+void
+JsonReplyWriter::consume(std::size_t bytes)
+{
+    pos_ += bytes;
+}
+
+bool
+JsonReplyWriter::prepare(std::size_t, std::function<void(void)>)
+{
+    if (pos_ == buf_.size() && !last_)
+    {
+        buf_.clear();
+        pos_ = 0;
+        appendChunk({});
+    }
+    return true;
+}
+
+std::vector<boost::asio::const_buffer>
+JsonReplyWriter::data()
+{
+    return {boost::asio::const_buffer(buf_.data() + pos_, buf_.size() - pos_)};
 }
 
 }  // namespace ripple
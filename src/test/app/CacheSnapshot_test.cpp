@@ -0,0 +1,152 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <test/jtx.h>
+
+#include <xrpld/app/ledger/LedgerMaster.h>
+#include <xrpld/app/misc/CacheSnapshot.h>
+#include <xrpld/app/misc/SHAMapStore.h>
+#include <xrpld/app/rdb/Wallet.h>
+#include <xrpld/core/JobQueue.h>
+#include <xrpld/shamap/Family.h>
+
+#include <xrpl/beast/unit_test.h>
+
+namespace ripple {
+namespace test {
+
+class CacheSnapshot_test : public beast::unit_test::suite
+{
+    void
+    testWallet()
+    {
+        testcase("Wallet");
+
+        jtx::Env env{*this};
+        auto db = env.app().getWalletDB().checkoutDb();
+        BEAST_EXPECT(!loadCacheSnapshot(*db));
+
+        CacheSnapshotKeys keys;
+        keys.lastRotated = 42;
+        keys.ledgers = {uint256{1}, uint256{2}};
+        keys.innerNodes = {uint256{3}};
+        saveCacheSnapshot(*db, keys);
+
+        auto loaded = loadCacheSnapshot(*db);
+        BEAST_EXPECT(loaded);
+        if (!loaded)
+            return;
+        BEAST_EXPECT(loaded->lastRotated == 42);
+        BEAST_EXPECT(loaded->ledgers == keys.ledgers);
+        BEAST_EXPECT(loaded->innerNodes == keys.innerNodes);
+
+        // Saving replaces the previous snapshot
+        keys.lastRotated = 43;
+        keys.ledgers.clear();
+        keys.innerNodes = {uint256{4}, uint256{5}, uint256{6}};
+        saveCacheSnapshot(*db, keys);
+
+        loaded = loadCacheSnapshot(*db);
+        BEAST_EXPECT(loaded);
+        if (!loaded)
+            return;
+        BEAST_EXPECT(loaded->lastRotated == 43);
+        BEAST_EXPECT(loaded->ledgers.empty());
+        BEAST_EXPECT(loaded->innerNodes == keys.innerNodes);
+    }
+
+    void
+    testWarm()
+    {
+        testcase("Warm");
+
+        using namespace jtx;
+        Env env{*this};
+        Account const alice{"alice"};
+        env.fund(XRP(10000), alice);
+        for (int i = 0; i < 4; ++i)
+        {
+            env(noop(alice));
+            env.close();
+        }
+
+        auto& family = env.app().getNodeFamily();
+        auto const treeNodeCache = family.getTreeNodeCache();
+        auto const fullBelowCache = family.getFullBelowCache();
+        auto const ledger = env.app().getLedgerMaster().getValidatedLedger();
+        fullBelowCache->insert(ledger->stateMap().getHash().as_uint256());
+
+        CacheSnapshot snapshot(env.app(), 100, env.journal);
+        snapshot.save();
+
+        auto keys = loadCacheSnapshot(*env.app().getWalletDB().checkoutDb());
+        BEAST_EXPECT(keys);
+        if (!keys)
+            return;
+        BEAST_EXPECT(keys->ledgers.size() > 1);
+        BEAST_EXPECT(!keys->innerNodes.empty());
+
+        auto warmed = [&]() {
+            for (auto const& hash : keys->innerNodes)
+            {
+                if (!treeNodeCache->fetch(hash))
+                    return false;
+            }
+            return true;
+        };
+
+        // Loading reads the saved objects back into the emptied caches.
+        // The FullBelow markers are not restored: a node being found again
+        // does not show that its subtree is complete.
+        treeNodeCache->clear();
+        fullBelowCache->clear();
+        snapshot.load();
+        env.app().getJobQueue().rendezvous();
+        BEAST_EXPECT(warmed());
+        BEAST_EXPECT(fullBelowCache->size() == 0);
+
+        // A snapshot saved before the node store rotated is ignored
+        keys->lastRotated = env.app().getSHAMapStore().getLastRotated() + 1;
+        saveCacheSnapshot(*env.app().getWalletDB().checkoutDb(), *keys);
+        treeNodeCache->clear();
+        snapshot.load();
+        env.app().getJobQueue().rendezvous();
+        BEAST_EXPECT(!treeNodeCache->fetch(keys->innerNodes.front()));
+
+        // So is any snapshot when it is disabled
+        CacheSnapshot disabled(env.app(), 0, env.journal);
+        disabled.save();
+        BEAST_EXPECT(
+            loadCacheSnapshot(*env.app().getWalletDB().checkoutDb())
+                ->lastRotated == keys->lastRotated);
+    }
+
+public:
+    void
+    run() override
+    {
+        testWallet();
+        testWarm();
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(CacheSnapshot, app, ripple);
+
+}  // namespace test
+}  // namespace ripple
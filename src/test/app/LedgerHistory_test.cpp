@@ -29,7 +29,9 @@
 #include <xrpl/ledger/OpenView.h>
 
 #include <chrono>
+#include <memory>
 #include <sstream>
+#include <vector>
 
 namespace ripple {
 namespace test {
@@ -194,10 +196,80 @@ public:
         }
     }
 
+    void
+    testMemoryBudget()
+    {
+        testcase("LedgerHistory memory budget");
+        using namespace jtx;
+        using namespace std::chrono;
+
+        // Without a budget, ledgers are only charged
+        {
+            Env env{*this};
+            LedgerHistory lh{beast::insight::NullCollector::New(), env.app()};
+            auto const genesis = makeLedger({}, env, lh, 0s);
+            auto const genesisBytes = lh.getCacheBytes();
+            BEAST_EXPECT(genesisBytes > 0);
+
+            // A child is charged only for what it doesn't share
+            auto const ledgerA = makeLedger(genesis, env, lh, 4s);
+            auto const ledgerBytes = lh.getCacheBytes() - genesisBytes;
+            BEAST_EXPECT(ledgerBytes > 0);
+
+            // Inserting a ledger again doesn't charge it twice
+            lh.insert(ledgerA, true);
+            BEAST_EXPECT(lh.getCacheBytes() == genesisBytes + ledgerBytes);
+            BEAST_EXPECT(
+                lh.getLedgerHash(ledgerA->seq()) == ledgerA->info().hash);
+            BEAST_EXPECT(lh.getLedgerHash(genesis->seq()).isZero());
+            BEAST_EXPECT(lh.getCacheEvictions() == 0);
+
+            BEAST_EXPECT(lh.fixIndex(ledgerA->seq(), ledgerA->info().hash));
+            BEAST_EXPECT(!lh.fixIndex(ledgerA->seq(), genesis->info().hash));
+            BEAST_EXPECT(
+                lh.getLedgerHash(ledgerA->seq()) == genesis->info().hash);
+        }
+
+        // With a budget, the oldest ledgers are released from the cache
+        {
+            Env env{*this, envconfig([](std::unique_ptr<Config> cfg) {
+                        cfg->LEDGER_CACHE_BYTES = 1;
+                        return cfg;
+                    })};
+            LedgerHistory lh{beast::insight::NullCollector::New(), env.app()};
+            auto const genesis = makeLedger({}, env, lh, 0s);
+            BEAST_EXPECT(lh.getCacheEvictions() == 0);
+
+            std::vector<std::shared_ptr<Ledger const>> ledgers{genesis};
+            for (int i = 0; i < 4; ++i)
+                ledgers.push_back(makeLedger(ledgers.back(), env, lh, 4s));
+            BEAST_EXPECT(lh.getCacheEvictions() == 4);
+
+            // Released ledgers can still be found while they are in use
+            for (auto const& ledger : ledgers)
+                BEAST_EXPECT(
+                    lh.getLedgerByHash(ledger->info().hash) == ledger);
+
+            // Finding a released ledger doesn't keep it in the cache, so
+            // it is freed once it is no longer in use
+            std::vector<std::weak_ptr<Ledger const>> const released(
+                ledgers.begin(), ledgers.end() - 1);
+            std::weak_ptr<Ledger const> const newest = ledgers.back();
+            auto const bytes = lh.getCacheBytes();
+            ledgers.clear();
+            lh.sweep();
+            for (auto const& ledger : released)
+                BEAST_EXPECT(ledger.expired());
+            BEAST_EXPECT(!newest.expired());
+            BEAST_EXPECT(lh.getCacheBytes() == bytes);
+        }
+    }
+
     void
     run() override
     {
         testHandleMismatch();
+        testMemoryBudget();
     }
 };
 
@@ -21,6 +21,7 @@
 #include <test/jtx/envconfig.h>
 
 #include <xrpld/app/ledger/BuildLedger.h>
+#include <xrpld/app/ledger/InboundLedgers.h>
 #include <xrpld/app/ledger/LedgerMaster.h>
 #include <xrpld/app/ledger/LedgerReplay.h>
 #include <xrpld/app/ledger/LedgerReplayTask.h>
@@ -169,6 +170,12 @@ public:
     {
     }
 
+    virtual std::size_t
+    historyWindow(std::uint32_t seq) override
+    {
+        return 1;
+    }
+
     virtual void
     gotFetchPack() override
     {
@@ -1608,10 +1615,101 @@ struct LedgerReplayerLong_test : public beast::unit_test::suite
     }
 };
 
+struct InboundLedgersHistory_test : public beast::unit_test::suite
+{
+    /** A peer that has a range of ledgers. */
+    class RangePeer : public TestPeer
+    {
+    public:
+        RangePeer(std::uint32_t minSeq, std::uint32_t maxSeq)
+            : TestPeer(false), minSeq_(minSeq), maxSeq_(maxSeq)
+        {
+        }
+
+        bool
+        hasRange(std::uint32_t uMin, std::uint32_t uMax) override
+        {
+            return uMin <= uMax && minSeq_ <= uMin && uMax <= maxSeq_;
+        }
+
+    private:
+        std::uint32_t const minSeq_;
+        std::uint32_t const maxSeq_;
+    };
+
+    static std::vector<std::shared_ptr<Peer>>
+    makePeers(std::size_t able, std::size_t unable)
+    {
+        std::vector<std::shared_ptr<Peer>> peers;
+        for (std::size_t i = 0; i < able; ++i)
+            peers.push_back(std::make_shared<RangePeer>(100, 200));
+        for (std::size_t i = 0; i < unable; ++i)
+            peers.push_back(std::make_shared<RangePeer>(300, 400));
+        return peers;
+    }
+
+    void
+    testWindow()
+    {
+        testcase("History window");
+
+        // Without enough peers that can serve the ledger the window is the
+        // fetch size
+        BEAST_EXPECT(computeHistoryWindow({}, 150, 4) == 4);
+        BEAST_EXPECT(computeHistoryWindow(makePeers(0, 10), 150, 4) == 4);
+        BEAST_EXPECT(computeHistoryWindow(makePeers(3, 10), 150, 4) == 4);
+
+        // It grows with them, ignoring the peers without the ledger
+        BEAST_EXPECT(computeHistoryWindow(makePeers(6, 10), 150, 4) == 6);
+        BEAST_EXPECT(computeHistoryWindow(makePeers(6, 10), 350, 4) == 10);
+        BEAST_EXPECT(computeHistoryWindow(makePeers(6, 10), 500, 4) == 4);
+
+        // Up to several times the fetch size
+        BEAST_EXPECT(computeHistoryWindow(makePeers(16, 0), 150, 4) == 16);
+        BEAST_EXPECT(computeHistoryWindow(makePeers(50, 0), 150, 4) == 16);
+    }
+
+    void
+    testFetchInfo()
+    {
+        testcase("History fetch info");
+
+        using namespace jtx;
+        Env env{*this};
+
+        auto history = [&env]() {
+            return env.rpc("fetch_info")[jss::result][jss::info][jss::history];
+        };
+
+        auto before = history();
+        BEAST_EXPECT(before[jss::historical_perminute].asUInt() == 0);
+        BEAST_EXPECT(before[jss::in_flight].asUInt() == 0);
+        BEAST_EXPECT(before[jss::window].asUInt() == 0);
+
+        // The window reported is the last one used for backfill
+        auto const window = env.app().getInboundLedgers().historyWindow(
+            env.closed()->info().seq);
+        BEAST_EXPECT(
+            window == env.app().config().getValueFor(SizedItem::ledgerFetch));
+
+        auto after = history();
+        BEAST_EXPECT(after[jss::window].asUInt() == window);
+        BEAST_EXPECT(after[jss::in_flight].asUInt() == 0);
+    }
+
+    void
+    run() override
+    {
+        testWindow();
+        testFetchInfo();
+    }
+};
+
 BEAST_DEFINE_TESTSUITE(LedgerReplay, app, ripple);
 BEAST_DEFINE_TESTSUITE_PRIO(LedgerReplayer, app, ripple, 1);
 BEAST_DEFINE_TESTSUITE(LedgerReplayerTimeout, app, ripple);
 BEAST_DEFINE_TESTSUITE_MANUAL(LedgerReplayerLong, app, ripple);
+BEAST_DEFINE_TESTSUITE(InboundLedgersHistory, app, ripple);
 
 }  // namespace test
 }  // namespace ripple
@@ -0,0 +1,148 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <test/jtx.h>
+
+#include <xrpld/app/ledger/LedgerMaster.h>
+#include <xrpld/app/ledger/PendingSaves.h>
+
+#include <xrpl/beast/unit_test.h>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace ripple {
+namespace test {
+
+class PendingSaves_test : public beast::unit_test::suite
+{
+    static std::vector<std::shared_ptr<Ledger const>>
+    makeLedgers(jtx::Env& env, std::size_t count)
+    {
+        std::vector<std::shared_ptr<Ledger const>> ledgers;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            env.close();
+            ledgers.push_back(env.app().getLedgerMaster().getClosedLedger());
+        }
+        return ledgers;
+    }
+
+    void
+    testQueue()
+    {
+        testcase("Queue");
+
+        using namespace std::chrono_literals;
+        jtx::Env env{*this};
+        auto const ledgers = makeLedgers(env, 3);
+
+        PendingSaves saves;
+        BEAST_EXPECT(saves.queued() == 0);
+        BEAST_EXPECT(!saves.queueAge());
+        BEAST_EXPECT(!saves.next(true));
+
+        // Only the first ledger queued asks for a writer
+        BEAST_EXPECT(saves.enqueue(ledgers[0], true));
+        auto const age = saves.queueAge();
+        BEAST_EXPECT(age && *age >= 0s);
+        BEAST_EXPECT(!saves.enqueue(ledgers[1], true));
+        BEAST_EXPECT(saves.queued() == 2);
+        BEAST_EXPECT(saves.queueAge() >= age);
+
+        // Historical ledgers have a writer of their own
+        BEAST_EXPECT(saves.enqueue(ledgers[2], false));
+        BEAST_EXPECT(saves.queued() == 3);
+
+        // The writer takes the ledgers in the order they were queued, and
+        // each stays counted until it has been saved
+        BEAST_EXPECT(saves.next(true) == ledgers[0]);
+        BEAST_EXPECT(saves.queued() == 3);
+        BEAST_EXPECT(saves.queueAge() >= age);
+        saves.pop(true);
+        BEAST_EXPECT(saves.queued() == 2);
+        BEAST_EXPECT(saves.next(true) == ledgers[1]);
+        saves.pop(true);
+        BEAST_EXPECT(saves.queued() == 1);
+
+        // Ledgers queued while the writer works are left to it
+        BEAST_EXPECT(!saves.enqueue(ledgers[1], true));
+        BEAST_EXPECT(saves.next(true) == ledgers[1]);
+        saves.pop(true);
+
+        // Once the writer finds the queue empty, it is finished
+        BEAST_EXPECT(!saves.next(true));
+        BEAST_EXPECT(saves.enqueue(ledgers[0], true));
+
+        BEAST_EXPECT(saves.next(false) == ledgers[2]);
+        saves.pop(false);
+        BEAST_EXPECT(!saves.next(false));
+        BEAST_EXPECT(saves.next(true) == ledgers[0]);
+        saves.pop(true);
+        BEAST_EXPECT(!saves.next(true));
+        BEAST_EXPECT(saves.queued() == 0);
+        BEAST_EXPECT(!saves.queueAge());
+    }
+
+    void
+    testAbandon()
+    {
+        testcase("Abandon");
+
+        jtx::Env env{*this};
+        auto const ledgers = makeLedgers(env, 3);
+
+        PendingSaves saves;
+        BEAST_EXPECT(saves.enqueue(ledgers[0], true));
+        BEAST_EXPECT(!saves.enqueue(ledgers[1], true));
+        BEAST_EXPECT(!saves.enqueue(ledgers[2], true));
+        BEAST_EXPECT(saves.enqueue(ledgers[0], false));
+        BEAST_EXPECT(saves.next(true) == ledgers[0]);
+
+        // A failed writer drops the ledger it failed on and leaves the rest
+        // for the next one
+        saves.abandon(true);
+        BEAST_EXPECT(saves.queued() == 3);
+        BEAST_EXPECT(saves.enqueue(ledgers[0], true));
+        BEAST_EXPECT(saves.next(true) == ledgers[1]);
+        saves.pop(true);
+        BEAST_EXPECT(saves.next(true) == ledgers[2]);
+        saves.pop(true);
+        BEAST_EXPECT(saves.next(true) == ledgers[0]);
+        saves.pop(true);
+        BEAST_EXPECT(!saves.next(true));
+
+        // The other queue's writer is unaffected
+        BEAST_EXPECT(!saves.enqueue(ledgers[1], false));
+    }
+
+public:
+    void
+    run() override
+    {
+        testQueue();
+        testAbandon();
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(PendingSaves, app, ripple);
+
+}  // namespace test
+}  // namespace ripple
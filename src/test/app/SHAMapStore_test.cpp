@@ -27,6 +27,7 @@
 #include <xrpld/core/ConfigSections.h>
 #include <xrpld/nodestore/detail/DatabaseRotatingImp.h>
 
+#include <xrpl/beast/insight/NullCollector.h>
 #include <xrpl/protocol/jss.h>
 
 namespace ripple {
@@ -575,7 +576,8 @@ public:
                 std::to_string(env.app().config().getValueFor(
                     SizedItem::treeCacheAge, std::nullopt)));
 
-        NodeStoreScheduler scheduler(env.app().getJobQueue());
+        NodeStoreScheduler scheduler(
+            env.app().getJobQueue(), beast::insight::NullCollector::New());
 
         std::string const writableDb = "write";
         std::string const archiveDb = "archive";
@@ -29,6 +29,8 @@
 #include <xrpl/json/json_reader.h>
 #include <xrpl/protocol/jss.h>
 
+#include <boost/predef.h>
+
 #include <atomic>
 #include <chrono>
 #include <cmath>
@@ -1046,6 +1048,74 @@ public:
         }
     }
 
+    void
+    testProfiler()
+    {
+        testcase("profiler");
+
+        using namespace std::chrono;
+
+        {
+            // Profiling is off unless configured
+            Section section;
+            section.append("perf_log=perf.log");
+            auto const setup = perf::setup_PerfLog(section, "/");
+            BEAST_EXPECT(setup.sampleInterval == microseconds{0});
+
+            Fixture fixture{env_.app(), j_};
+            auto perfLog{fixture.perfLog(WithFile::no)};
+            BEAST_EXPECT(perfLog->profileJson().isNull());
+        }
+
+        Section section;
+        section.append("sample_interval=1");
+        auto setup = perf::setup_PerfLog(section, "/");
+        BEAST_EXPECT(setup.sampleInterval == milliseconds{1});
+
+        Fixture fixture{env_.app(), j_};
+        auto perfLog = perf::make_PerfLog(
+            setup, fixture.app_, j_, [&fixture]() { fixture.signalStop(); });
+        perfLog->start();
+
+        // Burn CPU inside a job until the profiler has sampled it
+        JobType const jobType = jtCLIENT;
+        std::string const prefix = JobTypes::name(jobType) + ';';
+        auto sampled = [&]() {
+            auto const profile = perfLog->profileJson();
+            for (auto const& stack : profile[jss::stacks])
+            {
+                if (stack.asString().starts_with(prefix))
+                    return true;
+            }
+            return false;
+        };
+
+        bool found = false;
+        double volatile sink = 0;
+        for (int i = 0; i < 200 && !found; ++i)
+        {
+            perfLog->jobStart(jobType, microseconds{0}, steady_clock::now(), 0);
+            auto const end = steady_clock::now() + milliseconds{10};
+            while (steady_clock::now() < end)
+                sink = sink + std::sqrt(static_cast<double>(i));
+            perfLog->jobFinish(jobType, microseconds{0}, 0);
+            found = sampled();
+        }
+        perfLog->stop();
+
+        auto const profile = perfLog->profileJson();
+        BEAST_EXPECT(profile.isObject());
+        BEAST_EXPECT(jsonToUint64(profile[jss::sample_interval_us]) == 1000);
+#if BOOST_OS_LINUX
+        BEAST_EXPECT(found);
+        BEAST_EXPECT(jsonToUint64(profile[jss::samples]) > 0);
+        BEAST_EXPECT(profile[jss::stacks].size() > 0);
+#endif
+        // One more for the placeholder counting the rest
+        BEAST_EXPECT(profile[jss::stacks].size() <= 101);
+        BEAST_EXPECT(!fixture.stopSignaled);
+    }
+
     void
     run() override
     {
@@ -1058,6 +1128,7 @@ public:
         testInvalidID(WithFile::yes);
         testRotate(WithFile::no);
         testRotate(WithFile::yes);
+        testProfiler();
     }
 };
 
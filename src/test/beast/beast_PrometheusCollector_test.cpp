@@ -0,0 +1,301 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpl/beast/insight/Groups.h>
+#include <xrpl/beast/insight/Insight.h>
+#include <xrpl/beast/net/IPAddressConversion.h>
+#include <xrpl/beast/unit_test.h>
+#include <xrpl/beast/utility/Journal.h>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/beast/core/flat_buffer.hpp>
+#include <boost/beast/http/empty_body.hpp>
+#include <boost/beast/http/message.hpp>
+#include <boost/beast/http/read.hpp>
+#include <boost/beast/http/string_body.hpp>
+#include <boost/beast/http/write.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace beast {
+namespace insight {
+
+class PrometheusCollector_test : public unit_test::suite
+{
+    std::shared_ptr<PrometheusCollector>
+    makeCollector(std::string const& prefix)
+    {
+        // Port zero, so that the system chooses a free one
+        return PrometheusCollector::New(
+            IP::Endpoint::from_string("127.0.0.1:0"),
+            prefix,
+            Journal{Journal::getNullSink()});
+    }
+
+    bool
+    contains(std::string const& text, std::string const& line)
+    {
+        return text.find(line + "\n") != std::string::npos;
+    }
+
+public:
+    void
+    testRender()
+    {
+        testcase("render");
+
+        auto const collector = makeCollector("node");
+        auto const groups = make_Groups(collector);
+
+        Counter const counter = groups->get("jobq")->make_counter("jobs");
+        Meter const meter = collector->make_meter("bytes_total");
+        Gauge const gauge = collector->make_gauge("Overlay", "Peers");
+        Event const event = collector->make_event("consensus.open");
+
+        counter.increment(3);
+        meter.increment(100);
+        gauge = 7;
+        gauge.increment(-10);
+        gauge.increment(2);
+        event.notify(std::chrono::milliseconds(1));
+        event.notify(std::chrono::milliseconds(30));
+        event.notify(std::chrono::milliseconds(20000));
+
+        int calls = 0;
+        Hook const hook = collector->make_hook([&]() { ++calls; });
+
+        auto const text = collector->render();
+        BEAST_EXPECT(calls == 1);
+
+        BEAST_EXPECT(contains(text, "# TYPE node_jobq_jobs counter"));
+        BEAST_EXPECT(contains(text, "node_jobq_jobs_total 3"));
+        BEAST_EXPECT(contains(text, "# TYPE node_bytes counter"));
+        BEAST_EXPECT(contains(text, "node_bytes_total 100"));
+        BEAST_EXPECT(contains(text, "# TYPE node_Overlay_Peers gauge"));
+        BEAST_EXPECT(contains(text, "node_Overlay_Peers 2"));
+
+        BEAST_EXPECT(contains(text, "# TYPE node_consensus_open histogram"));
+        BEAST_EXPECT(
+            contains(text, "node_consensus_open_bucket{le=\"1.0\"} 1"));
+        BEAST_EXPECT(
+            contains(text, "node_consensus_open_bucket{le=\"25.0\"} 1"));
+        BEAST_EXPECT(
+            contains(text, "node_consensus_open_bucket{le=\"50.0\"} 2"));
+        BEAST_EXPECT(
+            contains(text, "node_consensus_open_bucket{le=\"10000.0\"} 2"));
+        BEAST_EXPECT(
+            contains(text, "node_consensus_open_bucket{le=\"+Inf\"} 3"));
+        BEAST_EXPECT(contains(text, "node_consensus_open_count 3"));
+        BEAST_EXPECT(contains(text, "node_consensus_open_sum 20031"));
+
+        BEAST_EXPECT(text.size() >= 6);
+        BEAST_EXPECT(text.substr(text.size() - 6) == "# EOF\n");
+
+        // Hooks are not called again by a scrape within the second
+        collector->render();
+        BEAST_EXPECT(calls == 1);
+    }
+
+    void
+    testMerge()
+    {
+        testcase("merge");
+
+        auto const collector = makeCollector("");
+
+        // Metrics sharing a name are reported once, with their values summed
+        Gauge const gauge1 = collector->make_gauge("9lives");
+        Gauge const gauge2 = collector->make_gauge("9lives");
+        gauge1 = 4;
+        gauge2 = 5;
+
+        // A name already taken by a metric of another type is not reported
+        Counter const counter = collector->make_counter("9lives");
+        counter.increment(1);
+
+        {
+            Gauge const gauge3 = collector->make_gauge("gone");
+            gauge3 = 1;
+        }
+
+        auto const text = collector->render();
+        BEAST_EXPECT(contains(text, "# TYPE _9lives gauge"));
+        BEAST_EXPECT(contains(text, "_9lives 9"));
+        BEAST_EXPECT(text.find("_9lives_total") == std::string::npos);
+        BEAST_EXPECT(text.find("gone") == std::string::npos);
+    }
+
+    void
+    testHTTP()
+    {
+        testcase("HTTP");
+
+        namespace http = boost::beast::http;
+        using tcp = boost::asio::ip::tcp;
+
+        auto const collector = makeCollector("node");
+        Counter const counter = collector->make_counter("scraped");
+        counter.increment(5);
+
+        auto const endpoint = collector->local_endpoint();
+        if (!BEAST_EXPECT(endpoint.port() != 0))
+            return;
+
+        boost::asio::io_service ios;
+        tcp::socket socket{ios};
+        boost::system::error_code ec;
+        socket.connect(IPAddressConversion::to_asio_endpoint(endpoint), ec);
+        if (!BEAST_EXPECT(!ec))
+            return;
+
+        boost::beast::flat_buffer buffer;
+        auto request = [&](http::verb verb,
+                           std::string const& target,
+                           unsigned version = 11) {
+            http::request<http::empty_body> req{verb, target, version};
+            req.set(http::field::host, "localhost");
+            http::write(socket, req, ec);
+            http::response<http::string_body> res;
+            if (!ec)
+                http::read(socket, buffer, res, ec);
+            return res;
+        };
+
+        // Requests on one connection are answered in turn while it is
+        // kept alive
+        {
+            auto const res = request(http::verb::get, "/metrics?x=1");
+            BEAST_EXPECT(!ec);
+            BEAST_EXPECT(res.result() == http::status::ok);
+            BEAST_EXPECT(res.keep_alive());
+            BEAST_EXPECT(
+                res[http::field::content_type].starts_with(
+                    "application/openmetrics-text"));
+            BEAST_EXPECT(contains(res.body(), "node_scraped_total 5"));
+            BEAST_EXPECT(res.body().ends_with("# EOF\n"));
+        }
+        {
+            auto const res = request(http::verb::get, "/other");
+            BEAST_EXPECT(!ec);
+            BEAST_EXPECT(res.result() == http::status::not_found);
+        }
+        {
+            auto const res = request(http::verb::post, "/metrics");
+            BEAST_EXPECT(!ec);
+            BEAST_EXPECT(res.result() == http::status::method_not_allowed);
+            BEAST_EXPECT(res[http::field::allow] == "GET");
+        }
+
+        // An HTTP/1.0 request closes the connection once answered
+        {
+            counter.increment(1);
+            auto const res = request(http::verb::get, "/metrics", 10);
+            BEAST_EXPECT(!ec);
+            BEAST_EXPECT(res.result() == http::status::ok);
+            BEAST_EXPECT(!res.keep_alive());
+            BEAST_EXPECT(contains(res.body(), "node_scraped_total 6"));
+
+            http::response<http::string_body> res2;
+            http::read(socket, buffer, res2, ec);
+            BEAST_EXPECT(ec == http::error::end_of_stream);
+        }
+    }
+
+    void
+    testConnectionLimit()
+    {
+        testcase("connection limit");
+
+        namespace http = boost::beast::http;
+        using tcp = boost::asio::ip::tcp;
+
+        auto const collector = makeCollector("");
+        auto const endpoint = collector->local_endpoint();
+        if (!BEAST_EXPECT(endpoint.port() != 0))
+            return;
+
+        boost::asio::io_service ios;
+        boost::system::error_code ec;
+        auto connect = [&]() {
+            auto socket = std::make_unique<tcp::socket>(ios);
+            socket->connect(
+                IPAddressConversion::to_asio_endpoint(endpoint), ec);
+            BEAST_EXPECT(!ec);
+            return socket;
+        };
+
+        // Connections beyond the limit are closed without being served
+        std::vector<std::unique_ptr<tcp::socket>> sockets;
+        for (int i = 0; i < 16; ++i)
+            sockets.push_back(connect());
+
+        auto const extra = connect();
+        http::request<http::empty_body> req{http::verb::get, "/metrics", 11};
+        req.set(http::field::host, "localhost");
+        http::write(*extra, req, ec);
+        boost::beast::flat_buffer buffer;
+        http::response<http::string_body> res;
+        http::read(*extra, buffer, res, ec);
+        BEAST_EXPECT(ec);
+
+        // The connections within the limit are still served
+        http::write(*sockets.front(), req, ec);
+        BEAST_EXPECT(!ec);
+        http::read(*sockets.front(), buffer, res, ec);
+        BEAST_EXPECT(!ec);
+        BEAST_EXPECT(res.result() == http::status::ok);
+    }
+
+    void
+    testListenFailure()
+    {
+        testcase("listen failure");
+
+        // An address that isn't ours can't be bound, but the collector
+        // still works
+        auto const collector = PrometheusCollector::New(
+            IP::Endpoint::from_string("192.0.2.1:9090"),
+            "",
+            Journal{Journal::getNullSink()});
+        BEAST_EXPECT(collector->local_endpoint().port() == 0);
+
+        Gauge const gauge = collector->make_gauge("up");
+        gauge = 1;
+        BEAST_EXPECT(contains(collector->render(), "up 1"));
+    }
+
+    void
+    run() override
+    {
+        testRender();
+        testMerge();
+        testHTTP();
+        testConnectionLimit();
+        testListenFailure();
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(PrometheusCollector, beast, beast);
+
+}  // namespace insight
+}  // namespace beast
@@ -1515,6 +1515,50 @@ public:
                 expectStalled(96, false, 11 + i, 6, 3, __LINE__);
             }
         }
+
+        // Disputes in the same round share the peers' slots
+        {
+            auto peers = std::make_shared<Dispute::Peers>();
+            Dispute first{txTrue.id(), true, peers, numPeers, journal_};
+            Dispute second{txFalse.id(), false, peers, numPeers, journal_};
+
+            for (int i = 0; i < numPeers; ++i)
+            {
+                BEAST_EXPECT(first.setVote(PeerID(i), i % 3 == 0));
+                BEAST_EXPECT(second.setVote(peers->slot(PeerID(i)), i < 10));
+            }
+            BEAST_EXPECT(peers->find(PeerID(numPeers - 1)) == numPeers - 1);
+            BEAST_EXPECT(!peers->find(PeerID(numPeers)));
+
+            // An unchanged vote is not a change
+            BEAST_EXPECT(!first.setVote(*peers->find(PeerID(3)), true));
+            BEAST_EXPECT(!second.setVote(PeerID(3), true));
+
+            auto jv = first.getJson();
+            BEAST_EXPECT(jv["yays"] == 34);
+            BEAST_EXPECT(jv["nays"] == 66);
+            BEAST_EXPECT(jv["votes"].size() == numPeers);
+            BEAST_EXPECT(jv["votes"]["3"] == true);
+            BEAST_EXPECT(jv["votes"]["4"] == false);
+
+            // Removing a vote from one dispute leaves the other alone
+            first.unVote(PeerID(3));
+            first.unVote(*peers->find(PeerID(4)));
+            first.unVote(PeerID(numPeers + 1));
+            jv = first.getJson();
+            BEAST_EXPECT(jv["yays"] == 33);
+            BEAST_EXPECT(jv["nays"] == 65);
+            BEAST_EXPECT(!jv["votes"].isMember("3"));
+            BEAST_EXPECT(!peers->find(PeerID(numPeers + 1)));
+
+            jv = second.getJson();
+            BEAST_EXPECT(jv["yays"] == 10);
+            BEAST_EXPECT(jv["nays"] == 90);
+
+            // A peer that votes after unvoting counts as a new vote
+            BEAST_EXPECT(first.setVote(PeerID(3), false));
+            BEAST_EXPECT(first.getJson()["nays"] == 66);
+        }
     }
 
     void
@@ -642,6 +642,11 @@ class LedgerTrie_test : public beast::unit_test::suite
         std::uniform_int_distribution<> depthDist(0, depthConst - 1);
         std::uniform_int_distribution<> widthDist(0, width - 1);
         std::uniform_int_distribution<> flip(0, 1);
+
+        // Receives the same changes as t but is only queried at the end, so
+        // its preferred ledger is never served from a stale cache
+        LedgerTrie<Ledger> fresh;
+
         for (std::uint32_t i = 0; i < iterations; ++i)
         {
             // pick a random ledger history
@@ -657,11 +662,27 @@ class LedgerTrie_test : public beast::unit_test::suite
 
             // 50-50 to add remove
             if (flip(gen) == 0)
+            {
                 t.insert(h[curr]);
+                fresh.insert(h[curr]);
+            }
             else
+            {
                 t.remove(h[curr]);
+                fresh.remove(h[curr]);
+            }
             if (!BEAST_EXPECT(t.checkInvariants()))
                 return;
+            (void)t.getPreferred(Ledger::Seq{i % (depthConst + 1)});
+        }
+
+        for (std::uint32_t seq = 0; seq <= depthConst + 1; ++seq)
+        {
+            auto const cached = t.getPreferred(Ledger::Seq{seq});
+            auto const computed = fresh.getPreferred(Ledger::Seq{seq});
+            BEAST_EXPECT(
+                cached.has_value() == computed.has_value() &&
+                (!cached || cached->id == computed->id));
         }
     }
 
@@ -0,0 +1,139 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpld/app/consensus/RCLConsensusTimeline.h>
+
+#include <xrpl/beast/insight/NullCollector.h>
+#include <xrpl/beast/unit_test.h>
+#include <xrpl/protocol/SecretKey.h>
+
+#include <thread>
+
+namespace ripple {
+namespace test {
+
+class RCLConsensusTimeline_test : public beast::unit_test::suite
+{
+    static RCLConsensusTimeline::Round
+    makeRound(LedgerIndex seq)
+    {
+        RCLConsensusTimeline::Round round;
+        round.seq = seq;
+        round.state = ConsensusState::Yes;
+        round.open = std::chrono::milliseconds{2000};
+        round.establish = std::chrono::milliseconds{1500};
+        round.establishRounds = 2;
+        round.disputes = 1;
+        round.proposers = 2;
+        round.build = std::chrono::milliseconds{40};
+        round.accept = std::chrono::milliseconds{90};
+        return round;
+    }
+
+public:
+    void
+    run() override
+    {
+        using namespace std::chrono_literals;
+
+        RCLConsensusTimeline timeline(3, beast::insight::NullCollector::New());
+        BEAST_EXPECT(timeline.getJson().size() == 0);
+
+        auto const alice = randomKeyPair(KeyType::secp256k1).first;
+        auto const bob = randomKeyPair(KeyType::ed25519).first;
+
+        // Proposals are attributed to the round in which they arrived
+        timeline.startRound();
+        timeline.peerProposal(alice, uint256{1}, true);
+        timeline.peerProposal(bob, uint256{2}, true);
+        auto first = makeRound(10);
+        first.validate = 5ms;
+        timeline.endRound(std::move(first));
+
+        timeline.startRound();
+        timeline.peerProposal(bob, uint256{3}, true);
+        timeline.endRound(makeRound(11));
+
+        {
+            auto const jv = timeline.getJson();
+            BEAST_EXPECT(jv.size() == 2);
+
+            auto const& r0 = jv[0u];
+            BEAST_EXPECT(r0["ledger_seq"].asUInt() == 10);
+            BEAST_EXPECT(r0["state"].asString() == "yes");
+            BEAST_EXPECT(r0["open_ms"].asInt() == 2000);
+            BEAST_EXPECT(r0["establish_ms"].asInt() == 1500);
+            BEAST_EXPECT(r0["establish_rounds"].asInt() == 2);
+            BEAST_EXPECT(r0["disputes"].asInt() == 1);
+            BEAST_EXPECT(r0["build_ms"].asInt() == 40);
+            BEAST_EXPECT(r0["validate_ms"].asInt() == 5);
+            BEAST_EXPECT(r0["accept_ms"].asInt() == 90);
+            BEAST_EXPECT(r0["proposals"].size() == 2);
+            BEAST_EXPECT(r0["proposals"].isMember(
+                toBase58(TokenType::NodePublic, alice)));
+
+            auto const& r1 = jv[1u];
+            BEAST_EXPECT(r1["ledger_seq"].asUInt() == 11);
+            BEAST_EXPECT(!r1.isMember("validate_ms"));
+            BEAST_EXPECT(r1["proposals"].size() == 1);
+            BEAST_EXPECT(r1["proposals"].isMember(
+                toBase58(TokenType::NodePublic, bob)));
+        }
+
+        // Proposals for the next round that the next round replays are
+        // recorded as arriving when they were received, before it started
+        timeline.startRound();
+        timeline.peerProposal(alice, uint256{4}, false);
+        std::this_thread::sleep_for(5ms);
+        timeline.endRound(makeRound(12));
+        timeline.startRound();
+        timeline.replayedProposal(alice, uint256{4});
+        timeline.replayedProposal(bob, uint256{5});
+        timeline.endRound(makeRound(13));
+        {
+            auto const jv = timeline.getJson();
+            auto const& proposals = jv[2u]["proposals"];
+            BEAST_EXPECT(jv[2u]["ledger_seq"].asUInt() == 13);
+            BEAST_EXPECT(proposals.size() == 2);
+            BEAST_EXPECT(
+                proposals[toBase58(TokenType::NodePublic, alice)].asInt() <=
+                -5);
+            BEAST_EXPECT(
+                proposals[toBase58(TokenType::NodePublic, bob)].asInt() >= 0);
+        }
+
+        // Only the most recent rounds are kept
+        for (LedgerIndex seq = 14; seq < 16; ++seq)
+        {
+            timeline.startRound();
+            timeline.endRound(makeRound(seq));
+        }
+
+        auto const jv = timeline.getJson();
+        BEAST_EXPECT(jv.size() == 3);
+        BEAST_EXPECT(jv[0u]["ledger_seq"].asUInt() == 13);
+        BEAST_EXPECT(jv[2u]["ledger_seq"].asUInt() == 15);
+        BEAST_EXPECT(jv[2u]["proposals"].size() == 0);
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(RCLConsensusTimeline, consensus, ripple);
+
+}  // namespace test
+}  // namespace ripple
@@ -26,6 +26,7 @@
 #include <xrpl/beast/clock/manual_clock.h>
 #include <xrpl/beast/unit_test.h>
 
+#include <memory>
 #include <vector>
 
 namespace ripple {
@@ -255,6 +256,107 @@ class Validations_test : public beast::unit_test::suite
         }
     };
 
+    // A validation whose copies share their trust status, like RCLValidation
+    // wrapping a shared STValidation
+    class SharedValidation
+    {
+        std::shared_ptr<Validation> val_;
+
+    public:
+        using NodeKey = Validation::NodeKey;
+        using NodeID = Validation::NodeID;
+
+        explicit SharedValidation(Validation const& val)
+            : val_(std::make_shared<Validation>(val))
+        {
+        }
+
+        Ledger::ID
+        ledgerID() const
+        {
+            return val_->ledgerID();
+        }
+
+        Ledger::Seq
+        seq() const
+        {
+            return val_->seq();
+        }
+
+        NetClock::time_point
+        signTime() const
+        {
+            return val_->signTime();
+        }
+
+        NetClock::time_point
+        seenTime() const
+        {
+            return val_->seenTime();
+        }
+
+        NodeKey const&
+        key() const
+        {
+            return val_->key();
+        }
+
+        NodeID const&
+        nodeID() const
+        {
+            return val_->nodeID();
+        }
+
+        bool
+        trusted() const
+        {
+            return val_->trusted();
+        }
+
+        bool
+        full() const
+        {
+            return val_->full();
+        }
+
+        std::uint64_t
+        cookie() const
+        {
+            return val_->cookie();
+        }
+
+        std::optional<std::uint32_t>
+        loadFee() const
+        {
+            return val_->loadFee();
+        }
+
+        Validation const&
+        unwrap() const
+        {
+            return *val_;
+        }
+
+        void
+        setTrusted()
+        {
+            val_->setTrusted();
+        }
+
+        void
+        setUntrusted()
+        {
+            val_->setUntrusted();
+        }
+    };
+
+    class SharedAdaptor : public Adaptor
+    {
+    public:
+        using Adaptor::Adaptor;
+        using Validation = SharedValidation;
+    };
+
     Ledger const genesisLedger{Ledger::MakeGenesis{}};
 
     void
@@ -1002,6 +1104,52 @@ class Validations_test : public beast::unit_test::suite
 
         BEAST_EXPECT(ValStatus::current == harness.add(b.validate(ledgerA)));
         BEAST_EXPECT(harness.vals().numTrustedForLedger(ledgerA.id()) == 1);
+
+        // The count follows changes of trust
+        Ledger ledgerB = h["b"];
+        std::vector<Node> nodes;
+        hash_set<PeerID> removed;
+        for (int i = 0; i < 128; ++i)
+        {
+            nodes.push_back(harness.makeNode());
+            harness.add(nodes.back().validate(ledgerB));
+            if (i % 2 == 0)
+                removed.insert(nodes.back().nodeID());
+        }
+        BEAST_EXPECT(harness.vals().numTrustedForLedger(ledgerB.id()) == 128);
+
+        harness.vals().trustChanged({}, removed);
+        BEAST_EXPECT(harness.vals().numTrustedForLedger(ledgerB.id()) == 64);
+
+        harness.vals().trustChanged(removed, {});
+        BEAST_EXPECT(harness.vals().numTrustedForLedger(ledgerB.id()) == 128);
+
+        // The count is right when the copies of a validation share their
+        // trust status, so flipping one flips all of them
+        {
+            ValidationParms p;
+            beast::manual_clock<std::chrono::steady_clock> clock;
+            Validations<SharedAdaptor> vals(p, clock, clock, h.oracle);
+
+            Ledger ledgerC = h["c"];
+            hash_set<PeerID> removed;
+            for (std::uint32_t i = 0; i < 8; ++i)
+            {
+                Node node(PeerID{i}, clock);
+                SharedValidation const val{node.validate(ledgerC)};
+                BEAST_EXPECT(
+                    ValStatus::current == vals.add(node.nodeID(), val));
+                if (i % 2 == 0)
+                    removed.insert(node.nodeID());
+            }
+            BEAST_EXPECT(vals.numTrustedForLedger(ledgerC.id()) == 8);
+
+            vals.trustChanged({}, removed);
+            BEAST_EXPECT(vals.numTrustedForLedger(ledgerC.id()) == 4);
+
+            vals.trustChanged(removed, {});
+            BEAST_EXPECT(vals.numTrustedForLedger(ledgerC.id()) == 8);
+        }
     }
 
     void
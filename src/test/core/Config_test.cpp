@@ -1495,6 +1495,52 @@ r.ripple.com:51235
         BEAST_EXPECT(!testDiverged("901"));
     }
 
+    void
+    testWorkersCpus()
+    {
+        testcase("workers cpus");
+
+        auto load = [](std::string const& value)
+            -> std::optional<std::vector<unsigned>> {
+            Config c;
+            try
+            {
+                c.loadFromString("[workers_cpus]\n" + value);
+            }
+            catch (std::runtime_error const&)
+            {
+                return std::nullopt;
+            }
+            return c.WORKERS_CPUS;
+        };
+
+        {
+            Config c;
+            c.loadFromString("[io_workers]\n2");
+            BEAST_EXPECT(c.WORKERS_CPUS.empty());
+            BEAST_EXPECT(c.IO_WORKERS_CPUS.empty());
+        }
+
+        BEAST_EXPECT((load("3") == std::vector<unsigned>{3}));
+        BEAST_EXPECT((load("0-3") == std::vector<unsigned>{0, 1, 2, 3}));
+        BEAST_EXPECT(
+            (load("8, 0-1,2-2 ,1") == std::vector<unsigned>{0, 1, 2, 8}));
+
+        BEAST_EXPECT(!load("x"));
+        BEAST_EXPECT(!load("3-1"));
+        BEAST_EXPECT(!load("0-"));
+        BEAST_EXPECT(!load("-1"));
+        BEAST_EXPECT(!load("0,,1"));
+        BEAST_EXPECT(!load("1024"));
+
+        {
+            Config c;
+            c.loadFromString("[io_workers_cpus]\n4-5");
+            BEAST_EXPECT(c.WORKERS_CPUS.empty());
+            BEAST_EXPECT((c.IO_WORKERS_CPUS == std::vector<unsigned>{4, 5}));
+        }
+    }
+
     void
     run() override
     {
@@ -1513,6 +1559,7 @@ r.ripple.com:51235
         testAmendment();
         testOverlay();
         testNetworkID();
+        testWorkersCpus();
     }
 };
 
@@ -20,9 +20,18 @@
 #include <test/jtx/Env.h>
 
 #include <xrpld/core/JobQueue.h>
+#include <xrpld/perflog/PerfLog.h>
 
+#include <xrpl/beast/insight/NullCollector.h>
 #include <xrpl/beast/unit_test.h>
 
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
 namespace ripple {
 namespace test {
 
@@ -151,12 +160,205 @@ class JobQueue_test : public beast::unit_test::suite
         }
     }
 
+    void
+    testPostTask()
+    {
+        jtx::Env env{*this};
+
+        JobQueue& jQueue = env.app().getJobQueue();
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        // Run f under the mutex, then wake the test thread
+        auto update = [&](auto f) {
+            {
+                std::lock_guard lock(mutex);
+                f();
+            }
+            cv.notify_all();
+        };
+        // Wait until pred holds, checking it under the mutex
+        auto waitFor = [&](auto pred) {
+            std::unique_lock lock(mutex);
+            return cv.wait_for(lock, std::chrono::seconds(10), pred);
+        };
+
+        {
+            // A Task waiting on a Signal resumes on a job once notified,
+            // and results pass up through awaited Tasks.
+            auto const signal =
+                std::make_shared<JobQueue::Signal>(jQueue, jtCLIENT, "Signal");
+            int result = 0;
+            bool waiting = false;
+            auto inner = [&]() -> Task<int> {
+                update([&]() { waiting = true; });
+                co_await *signal;
+                co_return 42;
+            };
+            BEAST_EXPECT(jQueue.postTask(
+                jtCLIENT, "PostTaskTest1", [&]() -> Task<> {
+                    auto const r = co_await inner();
+                    update([&]() { result = r; });
+                }));
+
+            BEAST_EXPECT(waitFor([&]() { return waiting; }));
+            BEAST_EXPECT(waitFor([&]() { return result == 0; }));
+            signal->notify();
+            BEAST_EXPECT(waitFor([&]() { return result == 42; }));
+        }
+        {
+            // A Signal notified before it is awaited does not suspend.
+            JobQueue::Signal signal{jQueue, jtCLIENT, "Signal"};
+            signal.notify();
+            bool notified = false;
+            BEAST_EXPECT(jQueue.postTask(
+                jtCLIENT, "PostTaskTest2", [&]() -> Task<> {
+                    bool const n = co_await signal;
+                    update([&]() { notified = n; });
+                }));
+            BEAST_EXPECT(waitFor([&]() { return notified; }));
+        }
+        {
+            // A Task does not keep a Signal it waits on alive. If the
+            // Signal is dropped unnotified, the Task resumes anyway and
+            // its captures are released.
+            auto signal =
+                std::make_shared<JobQueue::Signal>(jQueue, jtCLIENT, "Signal");
+            auto const token = std::make_shared<int>(0);
+            bool waiting = false;
+            std::optional<bool> notified;
+            BEAST_EXPECT(jQueue.postTask(
+                jtCLIENT, "PostTaskTest3", [&, token]() -> Task<> {
+                    auto awaiter = JobQueue::Signal::wait(signal);
+                    update([&]() { waiting = true; });
+                    bool const n = co_await awaiter;
+                    update([&]() { notified = n; });
+                }));
+
+            BEAST_EXPECT(waitFor([&]() { return waiting; }));
+            signal.reset();
+            BEAST_EXPECT(
+                waitFor([&]() { return notified.has_value(); }) && !*notified);
+            jQueue.rendezvous();
+            BEAST_EXPECT(token.use_count() == 1);
+        }
+        {
+            // An exception escaping a Task is logged, not thrown into the
+            // job, and the task's captures are released.
+            auto const token = std::make_shared<int>(0);
+            BEAST_EXPECT(
+                jQueue.postTask(jtCLIENT, "PostTaskTest4", [token]() -> Task<> {
+                    Throw<std::runtime_error>("PostTaskTest4");
+                    co_return;
+                }));
+            jQueue.rendezvous();
+            BEAST_EXPECT(token.use_count() == 1);
+        }
+        {
+            // stop() does not wait on a Signal that is never notified. It
+            // resumes the Task waiting on it, and the co_await yields
+            // false. Nor can the Task wait on another Signal.
+            auto const signal =
+                std::make_shared<JobQueue::Signal>(jQueue, jtCLIENT, "Signal");
+            bool waiting = false;
+            std::optional<bool> notified;
+            std::optional<bool> notifiedAgain;
+            BEAST_EXPECT(jQueue.postTask(
+                jtCLIENT, "PostTaskTest5", [&]() -> Task<> {
+                    update([&]() { waiting = true; });
+                    bool const n = co_await *signal;
+                    JobQueue::Signal another{jQueue, jtCLIENT, "Signal"};
+                    bool const m = co_await another;
+                    update([&]() {
+                        notified = n;
+                        notifiedAgain = m;
+                    });
+                }));
+            BEAST_EXPECT(waitFor([&]() { return waiting; }));
+
+            jQueue.stop();
+            BEAST_EXPECT(jQueue.isStopped());
+            BEAST_EXPECT(
+                waitFor([&]() { return notified.has_value(); }) && !*notified);
+            BEAST_EXPECT(notifiedAgain && !*notifiedAgain);
+
+            // Notifying it afterwards does nothing
+            signal->notify();
+        }
+        {
+            // If the JobQueue is stopped, postTask() should return false
+            // and the task should never run.
+            bool unprotected;
+            BEAST_EXPECT(!jQueue.postTask(
+                jtCLIENT, "PostTaskTest6", [&unprotected]() -> Task<> {
+                    unprotected = false;
+                    co_return;
+                }));
+        }
+    }
+
+    void
+    testPriority()
+    {
+        jtx::Env env{*this};
+
+        // With a single thread the jobs run one at a time
+        JobQueue jQueue{
+            1,
+            beast::insight::NullCollector::New(),
+            env.journal,
+            env.app().logs(),
+            env.app().getPerfLog()};
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool blocked = true;
+        std::vector<std::string> order;
+
+        // Hold the thread until all of the jobs are queued
+        BEAST_EXPECT(jQueue.addJob(jtADMIN, "PriorityTest", [&]() {
+            std::unique_lock lock(mutex);
+            cv.wait(lock, [&]() { return !blocked; });
+        }));
+
+        auto add = [&](JobType type, std::string const& name) {
+            BEAST_EXPECT(jQueue.addJob(type, "PriorityTest", [&, name]() {
+                std::lock_guard lock(mutex);
+                order.push_back(name);
+            }));
+        };
+        add(jtCLIENT, "client1");
+        add(jtTRANSACTION, "transaction1");
+        add(jtCLIENT, "client2");
+        add(jtADMIN, "admin");
+        add(jtTRANSACTION, "transaction2");
+        BEAST_EXPECT(jQueue.getJobCount(jtCLIENT) == 2);
+        BEAST_EXPECT(jQueue.getJobCountGE(jtTRANSACTION) >= 3);
+
+        {
+            std::lock_guard lock(mutex);
+            blocked = false;
+        }
+        cv.notify_all();
+        jQueue.rendezvous();
+
+        // Higher priority types run first, and each type in the order added
+        std::vector<std::string> const expected{
+            "admin", "transaction1", "transaction2", "client1", "client2"};
+        BEAST_EXPECT(order == expected);
+        BEAST_EXPECT(jQueue.getJobCountTotal(jtCLIENT) == 0);
+
+        jQueue.stop();
+    }
+
 public:
     void
     run() override
     {
         testAddJob();
         testPostCoro();
+        testPostTask();
+        testPriority();
     }
 };
 
@@ -17,6 +17,8 @@ OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 //==============================================================================
 
+#include <test/unit_test/SuiteJournal.h>
+
 #include <xrpld/core/detail/Workers.h>
 #include <xrpld/perflog/PerfLog.h>
 
@@ -25,9 +27,11 @@ OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 
 #include <chrono>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <vector>
 
 namespace ripple {
 
@@ -162,9 +166,62 @@ public:
         BEAST_EXPECT(cb.count == 0);
     }
 
+    void
+    testAffinity()
+    {
+        testcase("affinity");
+
+        auto warnings = [](test::StreamSink const& sink) {
+            std::size_t count = 0;
+            std::string const text = sink.messages().str();
+            for (auto pos = text.find("Unable to pin");
+                 pos != std::string::npos;
+                 pos = text.find("Unable to pin", pos + 1))
+                ++count;
+            return count;
+        };
+
+        auto runWorkers = [this](
+                              std::vector<unsigned> cpus,
+                              beast::Journal journal) {
+            TestCallback cb;
+            perf::PerfLogTest perfLog;
+            Workers w(cb, &perfLog, "Test", 4, std::move(cpus), journal);
+
+            // Every worker must have started before the pool is stopped
+            cb.count = 4;
+            for (int i = 0; i < 4; ++i)
+                w.addTask();
+
+            using namespace std::chrono_literals;
+            std::unique_lock<std::mutex> lk{cb.mut};
+            BEAST_EXPECT(
+                cb.cv.wait_for(lk, 10s, [&cb] { return cb.count == 0; }));
+            lk.unlock();
+            w.stop();
+        };
+
+        // A pool that cannot be pinned says so once, not once per thread
+        {
+            test::StreamSink sink{beast::severities::kWarning};
+            runWorkers(
+                {std::numeric_limits<unsigned>::max()},
+                beast::Journal{sink});
+            BEAST_EXPECT(warnings(sink) == 1);
+        }
+
+        // A pool that is not pinned has nothing to report
+        {
+            test::StreamSink sink{beast::severities::kWarning};
+            runWorkers({}, beast::Journal{sink});
+            BEAST_EXPECT(warnings(sink) == 0);
+        }
+    }
+
     void
     run() override
     {
+        testAffinity();
         testThreads(0, 0, 0);
         testThreads(1, 0, 1);
         testThreads(2, 1, 2);
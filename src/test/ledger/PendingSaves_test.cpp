@@ -50,10 +50,44 @@ struct PendingSaves_test : public beast::unit_test::suite
         BEAST_EXPECT(!ps.pending(0));
     }
 
+    void
+    testQueue()
+    {
+        PendingSaves ps;
+        std::shared_ptr<Ledger const> const ledger;
+
+        BEAST_EXPECT(ps.queued() == 0);
+        BEAST_EXPECT(!ps.queueAge());
+
+        // Only the first enqueue needs to start a writer
+        BEAST_EXPECT(ps.enqueue(ledger, false));
+        BEAST_EXPECT(!ps.enqueue(ledger, false));
+        BEAST_EXPECT(ps.queued() == 2);
+        BEAST_EXPECT(ps.queueAge());
+
+        // Current and historical ledgers have independent writers
+        BEAST_EXPECT(ps.enqueue(ledger, true));
+        BEAST_EXPECT(ps.drain(true).size() == 1);
+        BEAST_EXPECT(ps.queued() == 2);
+
+        // While the writer is draining, new ledgers join its queue
+        BEAST_EXPECT(ps.drain(false).size() == 2);
+        BEAST_EXPECT(!ps.enqueue(ledger, false));
+        BEAST_EXPECT(ps.drain(false).size() == 1);
+
+        // Once the writer finds the queue empty, it is done
+        BEAST_EXPECT(ps.drain(false).empty());
+        BEAST_EXPECT(ps.drain(true).empty());
+        BEAST_EXPECT(ps.queued() == 0);
+        BEAST_EXPECT(!ps.queueAge());
+        BEAST_EXPECT(ps.enqueue(ledger, false));
+    }
+
     void
     run() override
     {
         testSaves();
+        testQueue();
     }
 };
 
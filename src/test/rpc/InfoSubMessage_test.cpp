@@ -0,0 +1,131 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpld/rpc/InfoSub.h>
+
+#include <xrpl/beast/unit_test.h>
+#include <xrpl/json/json_reader.h>
+#include <xrpl/protocol/jss.h>
+#include <xrpl/server/WSSession.h>
+
+#include <string>
+#include <utility>
+
+namespace ripple {
+namespace test {
+
+class InfoSubMessage_test : public beast::unit_test::suite
+{
+    void
+    testRenderOnce()
+    {
+        testcase("Render once");
+
+        Json::Value jv(Json::objectValue);
+        jv[jss::type] = "ledgerClosed";
+        jv[jss::ledger_index] = 42;
+        InfoSubMessage const msg{jv};
+
+        auto const& first = msg.text();
+        auto const& second = msg.text();
+        BEAST_EXPECT(first);
+        BEAST_EXPECT(first.get() == second.get());
+
+        Json::Value parsed;
+        BEAST_EXPECT(Json::Reader().parse(*first, parsed));
+        BEAST_EXPECT(parsed == jv);
+        BEAST_EXPECT(msg.json() == jv);
+    }
+
+    void
+    testMultiApi()
+    {
+        testcase("Per API version");
+
+        MultiApiJson multi{Json::Value(Json::objectValue)};
+        multi.set(jss::type, "transaction");
+        multi.visit(RPC::apiVersion<1>, [](Json::Value& jv) {
+            jv[jss::ledger_index] = "7";
+        });
+        multi.visit(RPC::apiVersion<2>, [](Json::Value& jv) {
+            jv[jss::ledger_index] = 7;
+        });
+
+        MultiApiMessage const msg{multi};
+        BEAST_EXPECT(msg.at(1)->json()[jss::ledger_index].isString());
+        BEAST_EXPECT(msg.at(2)->json()[jss::ledger_index].isIntegral());
+        BEAST_EXPECT(msg.at(1).get() != msg.at(2).get());
+        BEAST_EXPECT(msg.at(2).get() == msg.at(2).get());
+
+        // An object that is no longer needed is moved in, not copied
+        MultiApiMessage const moved{std::move(multi)};
+        BEAST_EXPECT(moved.at(1)->json() == msg.at(1)->json());
+        BEAST_EXPECT(moved.at(2)->json() == msg.at(2)->json());
+    }
+
+    void
+    testSharedWSMsg()
+    {
+        testcase("Shared websocket message");
+
+        auto const buf = std::make_shared<std::string const>("0123456789");
+
+        // Two sessions share the buffer but write it independently
+        SharedWSMsg a{buf};
+        SharedWSMsg b{buf};
+
+        std::string out;
+        auto append = [&out](auto const& result) {
+            for (auto const& cb : result.second)
+                out.append(static_cast<char const*>(cb.data()), cb.size());
+        };
+
+        auto r = a.prepare(4, {});
+        BEAST_EXPECT(r.first == false);
+        append(r);
+        r = a.prepare(4, {});
+        BEAST_EXPECT(r.first == false);
+        append(r);
+        r = a.prepare(4, {});
+        BEAST_EXPECT(r.first == true);
+        append(r);
+        BEAST_EXPECT(out == *buf);
+
+        out.clear();
+        r = b.prepare(65536, {});
+        BEAST_EXPECT(r.first == true);
+        append(r);
+        BEAST_EXPECT(out == *buf);
+        BEAST_EXPECT(buf.use_count() == 3);
+    }
+
+public:
+    void
+    run() override
+    {
+        testRenderOnce();
+        testMultiApi();
+        testSharedWSMsg();
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(InfoSubMessage, rpc, ripple);
+
+}  // namespace test
+}  // namespace ripple
@@ -19,6 +19,8 @@
 
 #include <test/jtx.h>
 
+#include <xrpld/rpc/detail/Tuning.h>
+
 #include <xrpl/basics/StringUtilities.h>
 #include <xrpl/protocol/jss.h>
 
@@ -479,6 +481,78 @@ public:
         }
     }
 
+    void
+    testCachedPages()
+    {
+        testcase("Cached pages");
+
+        using namespace test::jtx;
+        Env env{*this};
+        Account const gw{"gateway"};
+        env.fund(XRP(100000), gw);
+        for (auto i = 0; i < 10; i++)
+        {
+            Account const bob{std::string("bob") + std::to_string(i)};
+            env.fund(XRP(1000), bob);
+        }
+        env.close();
+
+        auto& cache = env.app().getLedgerDataCache();
+
+        auto request = [&env](Json::Value const& params) {
+            return env.rpc(
+                "json", "ledger_data", to_string(params))[jss::result];
+        };
+
+        Json::Value jvParams;
+        jvParams[jss::ledger_index] = "validated";
+        jvParams[jss::limit] = 5;
+
+        // A closed ledger's pages are cached and served again unchanged
+        auto const first = request(jvParams);
+        BEAST_EXPECT(cache.size() == 1);
+        auto const second = request(jvParams);
+        BEAST_EXPECT(cache.size() == 1);
+        BEAST_EXPECT(cache.getHitRate() > 0);
+        BEAST_EXPECT(first == second);
+        BEAST_EXPECT(checkArraySize(second[jss::state], 5));
+        BEAST_EXPECT(second.isMember(jss::ledger));
+
+        // Any parameter that changes the page is part of the key
+        jvParams[jss::binary] = true;
+        auto const binary = request(jvParams);
+        BEAST_EXPECT(cache.size() == 2);
+        BEAST_EXPECT(binary[jss::state][0u].isMember(jss::data));
+
+        jvParams[jss::marker] = first[jss::marker];
+        auto const next = request(jvParams);
+        BEAST_EXPECT(cache.size() == 3);
+        BEAST_EXPECT(!next.isMember(jss::ledger));
+        BEAST_EXPECT(
+            next[jss::state][0u][jss::index] !=
+            binary[jss::state][0u][jss::index]);
+
+        // The open ledger is never cached
+        jvParams.removeMember(jss::marker);
+        jvParams[jss::ledger_index] = "current";
+        request(jvParams);
+        BEAST_EXPECT(cache.size() == 3);
+
+        // Nor are pages larger than the most a limited caller may ask for
+        jvParams[jss::ledger_index] = "validated";
+        jvParams[jss::limit] = RPC::Tuning::pageLength(true) + 1;
+        auto const large = request(jvParams);
+        BEAST_EXPECT(cache.size() == 3);
+        BEAST_EXPECT(large[jss::state].size() > 5);
+        BEAST_EXPECT(!large.isMember(jss::marker));
+
+        // Served pages can be changed without changing the cached page
+        jvParams[jss::limit] = 5;
+        auto changed = request(jvParams);
+        changed[jss::state][0u][jss::index] = "changed";
+        BEAST_EXPECT(request(jvParams) == binary);
+    }
+
     void
     run() override
     {
@@ -489,6 +563,7 @@ public:
         testMarkerFollow();
         testLedgerHeader();
         testLedgerType();
+        testCachedPages();
     }
 };
 
@@ -0,0 +1,211 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpl/beast/unit_test.h>
+#include <xrpl/beast/utility/Journal.h>
+#include <xrpl/json/Output.h>
+#include <xrpl/json/json_value.h>
+#include <xrpl/json/to_string.h>
+#include <xrpl/server/detail/JSONRPCUtil.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <optional>
+#include <string>
+
+namespace ripple {
+namespace test {
+
+class JsonReplyWriter_test : public beast::unit_test::suite
+{
+    // A reply whose document is about `size` bytes
+    static Json::Value
+    makeReply(std::size_t size)
+    {
+        // Each item takes 100 bytes, with its quotes and comma
+        Json::Value reply(Json::objectValue);
+        auto& items = reply["result"]["items"] = Json::arrayValue;
+        for (std::size_t i = 0; i < size / 100; ++i)
+            items.append(std::string(97, 'a' + i % 26));
+        reply["result"]["status"] = "success";
+        return reply;
+    }
+
+    // Everything the writer sends, taking at most `step` bytes at a time
+    static std::string
+    drain(Writer& writer, std::size_t step)
+    {
+        std::string out;
+        while (!writer.complete())
+        {
+            writer.prepare(step, {});
+            std::size_t n = 0;
+            for (auto const& b : writer.data())
+            {
+                auto const take = std::min(b.size(), step - n);
+                out.append(static_cast<char const*>(b.data()), take);
+                n += take;
+                if (n == step)
+                    break;
+            }
+            if (n == 0)
+                break;
+            writer.consume(n);
+        }
+        return out;
+    }
+
+    // Split a reply into its headers, without the Date header which
+    // changes every second, and its body
+    static std::pair<std::string, std::string>
+    split(std::string const& reply)
+    {
+        auto const end = reply.find("\r\n\r\n");
+        if (end == std::string::npos)
+            return {};
+        auto headers = reply.substr(0, end + 4);
+        if (auto const date = headers.find("Date: ");
+            date != std::string::npos)
+            headers.erase(date, headers.find("\r\n", date) + 2 - date);
+        return {headers, reply.substr(end + 4)};
+    }
+
+    // Decode a chunked body, or return nothing if it is malformed
+    std::optional<std::string>
+    dechunk(std::string const& body, std::size_t& chunks)
+    {
+        std::string decoded;
+        std::size_t pos = 0;
+        chunks = 0;
+        while (true)
+        {
+            // Every size but the terminator's has exactly 8 hex digits
+            auto const eol = body.find("\r\n", pos);
+            if (eol == std::string::npos)
+                return std::nullopt;
+            auto const digits = body.substr(pos, eol - pos);
+            if (digits == "0")
+                break;
+            if (!BEAST_EXPECT(digits.size() == 8) ||
+                !BEAST_EXPECT(
+                    digits.find_first_not_of("0123456789abcdef") ==
+                    std::string::npos))
+                return std::nullopt;
+            auto const size = std::strtoul(digits.c_str(), nullptr, 16);
+            pos = eol + 2;
+            if (body.size() < pos + size + 2 ||
+                body.compare(pos + size, 2, "\r\n") != 0)
+                return std::nullopt;
+            decoded.append(body, pos, size);
+            pos += size + 2;
+            ++chunks;
+        }
+        // The terminator ends the body
+        if (body.substr(pos) != "0\r\n\r\n")
+            return std::nullopt;
+        return decoded;
+    }
+
+public:
+    void
+    testContentLength()
+    {
+        testcase("Content-Length");
+
+        for (auto const [size, chunked] :
+             {std::pair{std::size_t{100}, true},
+              std::pair{JsonReplyWriter::chunkSize - 100, true},
+              std::pair{3 * JsonReplyWriter::chunkSize, false}})
+        {
+            auto const reply = makeReply(size);
+            auto const document = to_string(reply);
+
+            // The reply is what HTTPReply sends for the same document
+            std::string expected;
+            HTTPReply(
+                200,
+                document + "\n",
+                Json::stringOutput(expected),
+                beast::Journal{beast::Journal::getNullSink()});
+
+            std::optional<std::size_t> reported;
+            JsonReplyWriter writer(
+                200, Json::Value(reply), chunked, [&](std::size_t n) {
+                    reported = n;
+                });
+            auto const sent = drain(writer, 1000);
+
+            auto const [headers, body] = split(sent);
+            BEAST_EXPECT(split(expected) == split(sent));
+            BEAST_EXPECT(
+                headers.find(
+                    "Content-Length: " + std::to_string(body.size()) +
+                    "\r\n") != std::string::npos);
+            BEAST_EXPECT(body == document + "\n\r\n");
+
+            // Only the document itself is counted
+            BEAST_EXPECT(reported == document.size());
+        }
+    }
+
+    void
+    testChunked()
+    {
+        testcase("chunked");
+
+        auto const reply = makeReply(3 * JsonReplyWriter::chunkSize);
+        auto const document = to_string(reply);
+
+        std::optional<std::size_t> reported;
+        JsonReplyWriter writer(
+            503, Json::Value(reply), true, [&](std::size_t n) {
+                reported = n;
+            });
+
+        // Nothing past the first chunk is serialized until it is asked for
+        BEAST_EXPECT(!reported);
+        auto const sent = drain(writer, 4096);
+        BEAST_EXPECT(writer.complete());
+
+        auto const [headers, body] = split(sent);
+        BEAST_EXPECT(headers.starts_with("HTTP/1.1 503 "));
+        BEAST_EXPECT(
+            headers.find("Transfer-Encoding: chunked\r\n") !=
+            std::string::npos);
+        BEAST_EXPECT(headers.find("Content-Length") == std::string::npos);
+
+        std::size_t chunks = 0;
+        auto const decoded = dechunk(body, chunks);
+        BEAST_EXPECT(decoded == document + "\n\r\n");
+        BEAST_EXPECT(chunks >= 3);
+        BEAST_EXPECT(reported == document.size());
+    }
+
+    void
+    run() override
+    {
+        testContentLength();
+        testChunked();
+    }
+};
+
+BEAST_DEFINE_TESTSUITE(JsonReplyWriter, server, ripple);
+
+}  // namespace test
+}  // namespace ripple
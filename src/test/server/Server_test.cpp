@@ -36,6 +36,8 @@
 #include <boost/utility/in_place_factory.hpp>
 
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <thread>
@@ -314,6 +316,90 @@ public:
         pass();
     }
 
+    void
+    testPipelining()
+    {
+        testcase("Pipelined requests");
+
+        // Holds each request until told to reply
+        struct HoldingHandler : TestHandler
+        {
+            std::mutex mutex;
+            std::condition_variable cond;
+            std::vector<std::shared_ptr<Session>> sessions;
+
+            void
+            onRequest(Session& session)
+            {
+                std::lock_guard lock(mutex);
+                sessions.push_back(session.detach());
+                cond.notify_all();
+            }
+        };
+
+        TestSink sink{*this};
+        TestThread thread;
+        beast::Journal journal{sink};
+        HoldingHandler handler;
+        auto s = make_Server(handler, thread.get_io_service(), journal);
+        std::vector<Port> serverPort(1);
+        serverPort.back().ip =
+            beast::IP::Address::from_string(getEnvLocalhostAddr()),
+        serverPort.back().port = 0;
+        serverPort.back().protocol.insert("http");
+        auto eps = s->ports(serverPort);
+
+        boost::asio::io_service ios;
+        using socket = boost::asio::ip::tcp::socket;
+        socket sock(ios);
+        if (!connect(sock, eps.begin()->second))
+            return;
+
+        // All three are sent before any reply
+        if (!write(
+                sock,
+                "GET /1 HTTP/1.1\r\n"
+                "\r\n"
+                "GET /2 HTTP/1.1\r\n"
+                "\r\n"
+                "GET /3 HTTP/1.1\r\n"
+                "Connection: close\r\n"
+                "\r\n"))
+            return;
+
+        std::vector<std::shared_ptr<Session>> sessions;
+        {
+            std::unique_lock lock(handler.mutex);
+            if (!BEAST_EXPECT(handler.cond.wait_for(
+                    lock, std::chrono::seconds(10), [&] {
+                        return handler.sessions.size() == 3;
+                    })))
+                return;
+            sessions = std::move(handler.sessions);
+        }
+
+        // Reply last to first; the replies still arrive in request order
+        for (auto iter = sessions.rbegin(); iter != sessions.rend(); ++iter)
+        {
+            auto& session = **iter;
+            session.write(std::string(session.request().target()) + "\n");
+            if (beast::rfc2616::is_keep_alive(session.request()))
+                session.complete();
+            else
+                session.close(true);
+        }
+        sessions.clear();
+
+        std::string got;
+        boost::system::error_code ec;
+        boost::asio::read(sock, boost::asio::dynamic_buffer(got), ec);
+        BEAST_EXPECT(ec == boost::asio::error::eof);
+        BEAST_EXPECT(got == "/1\n/2\n/3\n");
+
+        sock.shutdown(socket::shutdown_both, ec);
+        s = nullptr;
+    }
+
     void
     stressTest()
     {
@@ -528,6 +614,7 @@ public:
     run() override
     {
         basicTests();
+        testPipelining();
         stressTest();
         testBadConfig();
     }
@@ -185,6 +185,37 @@ public:
         BEAST_EXPECT(source.deepCompare(destination));
 
         destination.invariants();
+
+        testWalkParallel();
+    }
+
+    void
+    testWalkParallel()
+    {
+        testcase("walk parallel");
+
+        using namespace beast::severities;
+        test::SuiteJournal journal("SHAMapSync_test", *this);
+
+        TestNodeFamily f(journal);
+        SHAMap source(SHAMapType::FREE, f);
+        for (int i = 0; i < 10000; ++i)
+            source.addItem(SHAMapNodeType::tnACCOUNT_STATE, makeRandomAS());
+        source.flushDirty(hotACCOUNT_NODE);
+
+        // Forget the nodes, so that the walk reads them from the node store
+        f.reset();
+
+        SHAMap loaded(SHAMapType::FREE, source.getHash().as_uint256(), f);
+        BEAST_EXPECT(loaded.fetchRoot(source.getHash(), nullptr));
+
+        std::vector<SHAMapMissingNode> missingNodes;
+        BEAST_EXPECT(loaded.walkMapParallel(missingNodes, 32));
+        BEAST_EXPECT(missingNodes.empty());
+
+        int count = 0;
+        loaded.visitLeaves([&count](auto const&) { ++count; });
+        BEAST_EXPECT(count == 10000);
     }
 };
 
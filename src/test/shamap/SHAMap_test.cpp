@@ -26,6 +26,7 @@
 #include <xrpl/basics/Buffer.h>
 #include <xrpl/beast/unit_test.h>
 #include <xrpl/beast/utility/Journal.h>
+#include <xrpl/protocol/digest.h>
 
 namespace ripple {
 namespace tests {
@@ -326,6 +327,147 @@ public:
                 BEAST_EXPECT(k.key() == keys[h]);
                 --h;
             }
+
+            // The root, then the inner nodes along the b928... prefix
+            auto const top = map.getTopInnerHashes(100);
+            BEAST_EXPECT(top.size() == 5);
+            BEAST_EXPECT(!top.empty() && top.front() == map.getHash());
+
+            auto const limited = map.getTopInnerHashes(2);
+            BEAST_EXPECT(
+                limited.size() == 2 &&
+                std::equal(limited.begin(), limited.end(), top.begin()));
+            BEAST_EXPECT(map.getTopInnerHashes(0).empty());
+
+            // A snapshot shares all but the path to what changed
+            auto const footprint = map.getMemoryFootprint(nullptr);
+            BEAST_EXPECT(footprint > 0);
+            BEAST_EXPECT(map.getMemoryFootprint(&map) == 0);
+            auto const copy = map.snapShot(true);
+            BEAST_EXPECT(copy->delItem(keys[0]));
+            auto const changed = copy->getMemoryFootprint(&map);
+            BEAST_EXPECT(changed > 0 && changed < footprint);
+        }
+
+        if (backed)
+            testcase("compare parallel backed");
+        else
+            testcase("compare parallel unbacked");
+
+        {
+            tests::TestNodeFamily tf{journal};
+            SHAMap ours{SHAMapType::FREE, tf};
+            if (!backed)
+                ours.setUnbacked();
+            for (std::uint32_t i = 0; i < 3000; ++i)
+                ours.addItem(
+                    SHAMapNodeType::tnTRANSACTION_NM,
+                    make_shamapitem(sha512Half(i), IntToVUC(i)));
+
+            // Nearly the same maps are compared on the calling thread
+            auto theirs = ours.snapShot(true);
+            BEAST_EXPECT(theirs->delItem(sha512Half(std::uint32_t{7})));
+
+            SHAMap::Delta serial;
+            SHAMap::Delta parallel;
+            BEAST_EXPECT(ours.compare(*theirs, serial, 65536));
+            BEAST_EXPECT(ours.compareParallel(*theirs, parallel, 65536));
+            BEAST_EXPECT(serial.size() == 1 && parallel.size() == 1);
+
+            // Widely different maps are compared a branch per thread
+            for (std::uint32_t i = 0; i < 3000; i += 3)
+                BEAST_EXPECT(theirs->delItem(sha512Half(i)));
+            for (std::uint32_t i = 3000; i < 4000; ++i)
+                theirs->addItem(
+                    SHAMapNodeType::tnTRANSACTION_NM,
+                    make_shamapitem(sha512Half(i), IntToVUC(i)));
+
+            serial.clear();
+            parallel.clear();
+            BEAST_EXPECT(ours.compare(*theirs, serial, 65536));
+            BEAST_EXPECT(ours.compareParallel(*theirs, parallel, 65536));
+            BEAST_EXPECT(serial.size() == 2001);
+            BEAST_EXPECT(parallel.size() == serial.size());
+            BEAST_EXPECT(std::equal(
+                serial.begin(),
+                serial.end(),
+                parallel.begin(),
+                parallel.end(),
+                [](auto const& a, auto const& b) {
+                    return a.first == b.first &&
+                        static_cast<bool>(a.second.first) ==
+                        static_cast<bool>(b.second.first) &&
+                        static_cast<bool>(a.second.second) ==
+                        static_cast<bool>(b.second.second);
+                }));
+
+            // However the differences fall, a budget that is enough for
+            // compare is enough for the branches together
+            parallel.clear();
+            BEAST_EXPECT(
+                ours.compareParallel(*theirs, parallel, serial.size() + 1));
+            BEAST_EXPECT(parallel.size() == serial.size());
+
+            // The budget bounds the work across all of the branches
+            parallel.clear();
+            BEAST_EXPECT(!ours.compareParallel(*theirs, parallel, 100));
+            BEAST_EXPECT(parallel.size() <= 100 + 16);
+        }
+
+        if (backed)
+            testcase("flush parallel backed");
+        else
+            testcase("flush parallel unbacked");
+
+        {
+            tests::TestNodeFamily tf{journal};
+            SHAMap serial{SHAMapType::FREE, tf};
+            SHAMap parallel{SHAMapType::FREE, tf};
+            if (!backed)
+            {
+                serial.setUnbacked();
+                parallel.setUnbacked();
+            }
+            for (std::uint32_t i = 0; i < 3000; ++i)
+            {
+                serial.addItem(
+                    SHAMapNodeType::tnTRANSACTION_NM,
+                    make_shamapitem(sha512Half(i), IntToVUC(i)));
+                parallel.addItem(
+                    SHAMapNodeType::tnTRANSACTION_NM,
+                    make_shamapitem(sha512Half(i), IntToVUC(i)));
+            }
+
+            // A new map is flushed a branch per thread
+            auto const flushed = serial.flushDirty(hotTRANSACTION_NODE);
+            BEAST_EXPECT(
+                parallel.flushDirtyParallel(hotTRANSACTION_NODE) == flushed);
+            BEAST_EXPECT(parallel.getHash() == serial.getHash());
+            BEAST_EXPECT(parallel.flushDirtyParallel(hotTRANSACTION_NODE) == 0);
+
+            // A few modified nodes are flushed on the calling thread
+            auto serialCopy = serial.snapShot(true);
+            auto parallelCopy = parallel.snapShot(true);
+            BEAST_EXPECT(serialCopy->delItem(sha512Half(std::uint32_t{7})));
+            BEAST_EXPECT(parallelCopy->delItem(sha512Half(std::uint32_t{7})));
+            BEAST_EXPECT(
+                parallelCopy->flushDirtyParallel(hotTRANSACTION_NODE) ==
+                serialCopy->flushDirty(hotTRANSACTION_NODE));
+            BEAST_EXPECT(parallelCopy->getHash() == serialCopy->getHash());
+
+            // Widely modified snapshots match too
+            for (std::uint32_t i = 0; i < 3000; i += 3)
+            {
+                BEAST_EXPECT(serialCopy->delItem(sha512Half(i)));
+                BEAST_EXPECT(parallelCopy->delItem(sha512Half(i)));
+            }
+            BEAST_EXPECT(
+                parallelCopy->flushDirtyParallel(hotTRANSACTION_NODE) ==
+                serialCopy->flushDirty(hotTRANSACTION_NODE));
+            BEAST_EXPECT(parallelCopy->getHash() == serialCopy->getHash());
+            BEAST_EXPECT(parallel.getHash() == serial.getHash());
+            for (std::uint32_t i = 2; i < 3000; i += 3)
+                BEAST_EXPECT(parallelCopy->hasItem(sha512Half(i)));
         }
     }
 };
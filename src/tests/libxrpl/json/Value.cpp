@@ -27,9 +27,11 @@
 
 #include <algorithm>
 #include <cmath>
+#include <memory>
 #include <regex>
 #include <sstream>
 #include <string>
+#include <utility>
 
 namespace ripple {
 
@@ -608,6 +610,37 @@ TEST_CASE("bad json")
     CHECK(r.parse(s, j));
 }
 
+TEST_CASE("strings")
+{
+    Json::Reader r;
+    Json::Value j;
+
+    CHECK(r.parse(
+        R"({"a":"x\"y","b":"x\\","c":"\\\"","d":"\\\\","e":"té\n"})",
+        j));
+    CHECK(j["a"].asString() == "x\"y");
+    CHECK(j["b"].asString() == "x\\");
+    CHECK(j["c"].asString() == "\\\"");
+    CHECK(j["d"].asString() == "\\\\");
+    CHECK(j["e"].asString() == "t\xc3\xa9\n");
+
+    std::string const blob(100000, 'A');
+    CHECK(r.parse("[\"" + blob + "\",\"" + blob + "\\\"\"]", j));
+    CHECK(j.size() == 2);
+    CHECK(j[0u].asString() == blob);
+    CHECK(j[1u].asString() == blob + "\"");
+
+    // Unterminated strings, including ones ending in an escaped quote
+    CHECK(!r.parse(R"({"a":"x)", j));
+    CHECK(!r.parse(R"({"a":"x\")", j));
+    CHECK(!r.parse(R"({"a":"x\\\"})", j));
+
+    // Duplicate members are still rejected
+    CHECK(!r.parse(R"({"a":1,"b":2,"a":3})", j));
+    CHECK(r.getFormatedErrorMessages().find("appears twice") !=
+          std::string::npos);
+}
+
 TEST_CASE("edge cases")
 {
     std::uint32_t max_uint = std::numeric_limits<std::uint32_t>::max();
@@ -879,6 +912,179 @@ TEST_CASE("compact")
     }
 }
 
+TEST_CASE("sparse and escaped")
+{
+    Json::Value j;
+    j["k\"ey"] = "tab\there\x01";
+    j["sparse"][2u] = 1;
+    j["sparse"][5u]["x"] = Json::arrayValue;
+    j["list"].append(1);
+    j["list"].append(j["list"][0u]);
+
+    std::string const expected =
+        "{\"k\\\"ey\":\"tab\\there\\u0001\",\"list\":[1,1],"
+        "\"sparse\":[null,null,1,null,null,{\"x\":[]}]}";
+    CHECK(Json::FastWriter().write(j) == expected);
+
+    std::string streamed;
+    Json::stream(j, [&streamed](void const* data, std::size_t n) {
+        streamed.append(static_cast<char const*>(data), n);
+    });
+    CHECK(streamed == expected + "\n");
+}
+
+TEST_CASE("share")
+{
+    Json::Value j;
+    Json::Reader r;
+    CHECK(r.parse("{\"a\":[1,{\"b\":\"c\"}],\"d\":true}", j));
+    auto const original = std::make_shared<Json::Value const>(j);
+
+    // A shared value reads the original
+    Json::Value shared = Json::Value::share(original);
+    Json::Value const& constShared = shared;
+    CHECK(shared == j);
+    CHECK(shared.isObject());
+    CHECK(shared.size() == 2);
+    CHECK(constShared["a"][1u]["b"] == "c");
+    CHECK(shared.getMemberNames() == j.getMemberNames());
+    CHECK(Json::FastWriter().write(shared) == Json::FastWriter().write(j));
+
+    // So do copies of it, without copying the original
+    Json::Value copy = shared;
+    CHECK(&constShared["d"] == &(*original)["d"]);
+    CHECK(&std::as_const(copy)["d"] == &(*original)["d"]);
+
+    // A change copies the elements first, leaving the original alone
+    copy["d"] = false;
+    copy["e"] = 1;
+    CHECK(*original == j);
+    CHECK(shared == j);
+    CHECK(copy["d"] == false);
+    CHECK(copy.size() == 3);
+    CHECK(&std::as_const(copy)["a"] != &(*original)["a"]);
+
+    // Iterating reads the original
+    {
+        std::size_t count = 0;
+        for (auto it = constShared.begin(); it != constShared.end(); ++it)
+            count += &*it == &(*original)[it.memberName()];
+        CHECK(count == 2);
+    }
+
+    // Arrays and objects within it stay shared until they change
+    {
+        Json::Value v = Json::Value::share(original);
+        for (auto it = v.begin(); it != v.end(); ++it)
+            CHECK(*it == (*original)[it.memberName()]);
+        CHECK(&std::as_const(v)["a"][1u] == &(*original)["a"][1u]);
+        v["e"] = 1;
+        CHECK(&std::as_const(v)["a"][1u]["b"] == &(*original)["a"][1u]["b"]);
+        v["a"][1u]["b"] = "x";
+        CHECK(v["a"][1u]["b"] == "x");
+        CHECK((*original)["a"][1u]["b"] == "c");
+        CHECK(&std::as_const(v)["a"][0u] != &(*original)["a"][0u]);
+    }
+
+    // Each way of changing a shared value detaches it
+    {
+        Json::Value v = Json::Value::share(original);
+        v.removeMember("d");
+        CHECK(!v.isMember("d"));
+        CHECK(original->isMember("d"));
+    }
+    {
+        Json::Value v = Json::Value::share(original);
+        v.clear();
+        CHECK(v.size() == 0);
+        CHECK(original->size() == 2);
+    }
+    {
+        Json::Value v = Json::Value::share(original);
+        for (auto it = v.begin(); it != v.end(); ++it)
+            *it = 0;
+        CHECK(v["d"] == 0);
+        CHECK((*original)["d"] == true);
+    }
+    {
+        auto const array =
+            std::make_shared<Json::Value const>((*original)["a"]);
+        Json::Value v = Json::Value::share(array);
+        CHECK(v.isArray());
+        v.append(2);
+        v[0u] = 0;
+        CHECK(v.size() == 3);
+        CHECK(v[0u] == 0);
+        CHECK(*array == (*original)["a"]);
+    }
+
+    // The original lives as long as something shares it, even in part
+    {
+        auto temp = std::make_shared<Json::Value const>(j);
+        std::weak_ptr<Json::Value const> const weak = temp;
+        Json::Value v = Json::Value::share(std::move(temp));
+        CHECK(!weak.expired());
+        v["d"] = 1;
+        CHECK(!weak.expired());
+        v["a"] = 1;
+        CHECK(weak.expired());
+    }
+
+    // Nested shared values are shared again when copied
+    {
+        Json::Value outer(Json::objectValue);
+        outer["page"] = Json::Value::share(original);
+        Json::Value const outerCopy = outer;
+        CHECK(&outerCopy["page"]["d"] == &(*original)["d"]);
+        outer["page"]["d"] = 5;
+        CHECK(outerCopy["page"]["d"] == true);
+    }
+
+    // Values other than arrays and objects are copied
+    CHECK(Json::Value::share(std::make_shared<Json::Value const>(7)) == 7);
+    CHECK(Json::Value::share(nullptr).isNull());
+}
+
+TEST_CASE("incremental")
+{
+    Json::Value j;
+    Json::Reader r;
+    CHECK(r.parse(
+        "{\"array\":[{\"12\":23},{},null,false,0.5,\"x\\\"y\"],"
+        "\"empty\":[],\"n\":-4,\"obj\":{\"a\":{\"b\":[1,2,3]}}}",
+        j));
+    // Sparse arrays are written with null placeholders
+    j["sparse"][3u] = 7;
+
+    auto const expected = Json::FastWriter().write(j);
+
+    for (std::size_t const chunk : {1, 2, 5, 16, 1000})
+    {
+        Json::IncrementalWriter w(j);
+        std::string out;
+        std::size_t calls = 0;
+        while (!w.write(out, chunk))
+        {
+            ++calls;
+            CHECK(out.size() >= calls * chunk);
+        }
+        CHECK(w.complete());
+        CHECK(out == expected);
+
+        // Once complete, nothing more is written
+        CHECK(w.write(out, chunk));
+        CHECK(out == expected);
+    }
+
+    {
+        Json::Value const scalar{"string"};
+        Json::IncrementalWriter w(scalar);
+        std::string out;
+        CHECK(w.write(out, 1));
+        CHECK(out == "\"string\"");
+    }
+}
+
 TEST_CASE("conversions")
 {
     // We have Json::Int, but not Json::Double or Json::Real.
@@ -26,6 +26,7 @@
 #include <xrpld/app/ledger/LedgerMaster.h>
 #include <xrpld/app/ledger/LocalTxs.h>
 #include <xrpld/app/ledger/OpenLedger.h>
+#include <xrpld/app/main/CollectorManager.h>
 #include <xrpld/app/misc/AmendmentTable.h>
 #include <xrpld/app/misc/HashRouter.h>
 #include <xrpld/app/misc/LoadFeeTrack.h>
@@ -96,6 +97,7 @@ RCLConsensus::Adaptor::Adaptor(
               crypto_prng(),
               std::numeric_limits<std::uint64_t>::max() - 1))
     , nUnlVote_(validatorKeys_.nodeID, j_)
+    , timeline_(timelineRounds, app.getCollectorManager().group("consensus"))
 {
     XRPL_ASSERT(
         valCookie_, "ripple::RCLConsensus::Adaptor::Adaptor : nonzero cookie");
@@ -172,6 +174,11 @@ RCLConsensus::Adaptor::share(RCLCxPeerPos const& peerPos)
 
     auto const& proposal = peerPos.proposal();
 
+    // Consensus shares the recent positions it replays into the round
+    if (proposal.isInitial())
+        timeline_.replayedProposal(
+            peerPos.publicKey(), peerPos.suppressionID());
+
     prop.set_proposeseq(proposal.proposeSeq());
     prop.set_closetime(proposal.closeTime().time_since_epoch().count());
 
@@ -479,6 +486,9 @@ RCLConsensus::Adaptor::doAccept(
     ConsensusMode const& mode,
     Json::Value&& consensusJson)
 {
+    using namespace std::chrono;
+    auto const acceptStart = steady_clock::now();
+
     prevProposers_ = result.proposers;
     prevRoundTime_ = result.roundTime.read();
 
@@ -539,6 +549,7 @@ RCLConsensus::Adaptor::doAccept(
         }
     }
 
+    auto const buildStart = steady_clock::now();
     auto built = buildLCL(
         prevLedger,
         retriableTxs,
@@ -548,6 +559,19 @@ RCLConsensus::Adaptor::doAccept(
         result.roundTime.read(),
         failed);
 
+    RCLConsensusTimeline::Round timing;
+    timing.seq = built.seq();
+    timing.hash = built.id();
+    timing.state = result.state;
+    timing.proposing = proposing;
+    timing.open = result.openTime;
+    timing.establish = result.roundTime.read();
+    timing.establishRounds = result.establishRounds;
+    timing.disputes = result.disputes.size();
+    timing.proposers = result.proposers;
+    timing.build =
+        duration_cast<milliseconds>(steady_clock::now() - buildStart);
+
     auto const newLCLHash = built.id();
     JLOG(j_.debug()) << "Built ledger #" << built.seq() << ": " << newLCLHash;
 
@@ -601,7 +625,10 @@ RCLConsensus::Adaptor::doAccept(
     if (validating_ && !consensusFail &&
         app_.getValidations().canValidateSeq(built.seq()))
     {
+        auto const validateStart = steady_clock::now();
         validate(built, result.txns, proposing);
+        timing.validate =
+            duration_cast<milliseconds>(steady_clock::now() - validateStart);
         JLOG(j_.info()) << "CNF Val " << newLCLHash;
     }
     else
@@ -701,6 +728,10 @@ RCLConsensus::Adaptor::doAccept(
             "ripple::RCLConsensus::Adaptor::doAccept : parent hash match");
     }
 
+    timing.accept =
+        duration_cast<milliseconds>(steady_clock::now() - acceptStart);
+    timeline_.endRound(std::move(timing));
+
     //-------------------------------------------------------------------------
     // we entered the round with the network,
     // see how close our close time is to other node's
@@ -970,6 +1001,8 @@ RCLConsensus::getJson(bool full) const
         ret = consensus_.getJson(full);
     }
     ret["validating"] = adaptor_.validating();
+    if (full)
+        ret["timeline"] = adaptor_.timeline().getJson();
     return ret;
 }
 
@@ -1027,7 +1060,11 @@ RCLConsensus::peerProposal(
     RCLCxPeerPos const& newProposal)
 {
     std::lock_guard _{mutex_};
-    return consensus_.peerProposal(now, newProposal);
+    bool const accepted = consensus_.peerProposal(now, newProposal);
+    if (newProposal.proposal().isInitial())
+        adaptor_.timeline().peerProposal(
+            newProposal.publicKey(), newProposal.suppressionID(), accepted);
+    return accepted;
 }
 
 bool
@@ -1130,6 +1167,7 @@ RCLConsensus::startRound(
     std::unique_ptr<std::stringstream> const& clog)
 {
     std::lock_guard _{mutex_};
+    adaptor_.timeline().startRound();
     consensus_.startRound(
         now,
         prevLgrId,
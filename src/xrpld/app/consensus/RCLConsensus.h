@@ -21,6 +21,7 @@
 #define RIPPLE_APP_CONSENSUS_RCLCONSENSUS_H_INCLUDED
 
 #include <xrpld/app/consensus/RCLCensorshipDetector.h>
+#include <xrpld/app/consensus/RCLConsensusTimeline.h>
 #include <xrpld/app/consensus/RCLCxLedger.h>
 #include <xrpld/app/consensus/RCLCxPeerPos.h>
 #include <xrpld/app/consensus/RCLCxTx.h>
@@ -55,6 +56,10 @@ class RCLConsensus
      */
     constexpr static unsigned int censorshipWarnInternal = 15;
 
+    /** How many rounds to keep in the consensus timeline.
+     */
+    constexpr static std::size_t timelineRounds = 128;
+
     // Implements the Adaptor template interface required by Consensus.
     class Adaptor
     {
@@ -88,6 +93,7 @@ class RCLConsensus
 
         RCLCensorshipDetector<TxID, LedgerIndex> censorshipDetector_;
         NegativeUNLVote nUnlVote_;
+        RCLConsensusTimeline timeline_;
 
     public:
         using Ledger_t = RCLCxLedger;
@@ -131,6 +137,18 @@ class RCLConsensus
             return mode_;
         }
 
+        RCLConsensusTimeline&
+        timeline()
+        {
+            return timeline_;
+        }
+
+        RCLConsensusTimeline const&
+        timeline() const
+        {
+            return timeline_;
+        }
+
         /** Called before kicking off a new consensus round.
 
             @param prevLedger Ledger that will be prior ledger for next round
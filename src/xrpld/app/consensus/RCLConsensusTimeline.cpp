@@ -0,0 +1,176 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpld/app/consensus/RCLConsensusTimeline.h>
+
+#include <algorithm>
+
+namespace ripple {
+
+namespace {
+
+char const*
+stateName(ConsensusState state)
+{
+    switch (state)
+    {
+        case ConsensusState::No:
+            return "no";
+        case ConsensusState::MovedOn:
+            return "moved_on";
+        case ConsensusState::Expired:
+            return "expired";
+        case ConsensusState::Yes:
+            return "yes";
+    }
+    return "unknown";
+}
+
+}  // namespace
+
+RCLConsensusTimeline::RCLConsensusTimeline(
+    std::size_t capacity,
+    beast::insight::Collector::ptr const& collector)
+    : capacity_(capacity)
+    , start_(clock_type::now())
+    , open_(collector->make_event("open"))
+    , establish_(collector->make_event("establish"))
+    , build_(collector->make_event("build"))
+    , validate_(collector->make_event("validate"))
+    , accept_(collector->make_event("accept"))
+    , disputes_(collector->make_gauge("disputes"))
+    , establishRounds_(collector->make_gauge("establish_rounds"))
+{
+}
+
+void
+RCLConsensusTimeline::startRound()
+{
+    std::lock_guard lock(mutex_);
+    start_ = clock_type::now();
+    proposals_.clear();
+}
+
+void
+RCLConsensusTimeline::peerProposal(
+    PublicKey const& validator,
+    uint256 const& id,
+    bool current)
+{
+    auto const now = clock_type::now();
+
+    std::lock_guard lock(mutex_);
+    if (current)
+    {
+        addProposal(validator, now);
+        return;
+    }
+
+    if (received_.size() >= maxReceived)
+        received_.pop_front();
+    received_.emplace_back(id, now);
+}
+
+void
+RCLConsensusTimeline::replayedProposal(
+    PublicKey const& validator,
+    uint256 const& id)
+{
+    auto arrival = clock_type::now();
+
+    std::lock_guard lock(mutex_);
+    auto const it = std::find_if(
+        received_.begin(), received_.end(), [&id](auto const& entry) {
+            return entry.first == id;
+        });
+    if (it != received_.end())
+    {
+        arrival = it->second;
+        received_.erase(it);
+    }
+    addProposal(validator, arrival);
+}
+
+void
+RCLConsensusTimeline::addProposal(
+    PublicKey const& validator,
+    clock_type::time_point arrival)
+{
+    proposals_.emplace_back(
+        validator,
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            arrival - start_));
+}
+
+void
+RCLConsensusTimeline::endRound(Round&& round)
+{
+    open_.notify(round.open);
+    establish_.notify(round.establish);
+    build_.notify(round.build);
+    if (round.validate)
+        validate_.notify(*round.validate);
+    accept_.notify(round.accept);
+    disputes_ = round.disputes;
+    establishRounds_ = round.establishRounds;
+
+    std::lock_guard lock(mutex_);
+    round.proposals = std::move(proposals_);
+    proposals_.clear();
+
+    if (rounds_.size() >= capacity_)
+        rounds_.pop_front();
+    rounds_.push_back(std::move(round));
+}
+
+Json::Value
+RCLConsensusTimeline::getJson() const
+{
+    using Int = Json::Value::Int;
+
+    Json::Value ret(Json::arrayValue);
+
+    std::lock_guard lock(mutex_);
+    for (auto const& round : rounds_)
+    {
+        Json::Value& r = ret.append(Json::objectValue);
+        r["ledger_seq"] = round.seq;
+        r["ledger_hash"] = to_string(round.hash);
+        r["state"] = stateName(round.state);
+        r["proposing"] = round.proposing;
+        r["open_ms"] = static_cast<Int>(round.open.count());
+        r["establish_ms"] = static_cast<Int>(round.establish.count());
+        r["establish_rounds"] = static_cast<Int>(round.establishRounds);
+        r["disputes"] = static_cast<Int>(round.disputes);
+        r["proposers"] = static_cast<Int>(round.proposers);
+        r["build_ms"] = static_cast<Int>(round.build.count());
+        if (round.validate)
+            r["validate_ms"] = static_cast<Int>(round.validate->count());
+        r["accept_ms"] = static_cast<Int>(round.accept.count());
+
+        Json::Value& proposals = r["proposals"] = Json::objectValue;
+        for (auto const& [validator, arrival] : round.proposals)
+            proposals[toBase58(TokenType::NodePublic, validator)] =
+                static_cast<Int>(arrival.count());
+    }
+
+    return ret;
+}
+
+}  // namespace ripple
@@ -0,0 +1,165 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#ifndef RIPPLE_APP_CONSENSUS_RCLCONSENSUSTIMELINE_H_INCLUDED
+#define RIPPLE_APP_CONSENSUS_RCLCONSENSUSTIMELINE_H_INCLUDED
+
+#include <xrpld/consensus/ConsensusTypes.h>
+
+#include <xrpl/basics/base_uint.h>
+#include <xrpl/beast/insight/Collector.h>
+#include <xrpl/beast/insight/Event.h>
+#include <xrpl/beast/insight/Gauge.h>
+#include <xrpl/json/json_value.h>
+#include <xrpl/protocol/Protocol.h>
+#include <xrpl/protocol/PublicKey.h>
+
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace ripple {
+
+/** Records how long each consensus round spent in each of its stages.
+
+    A round starts when consensus begins building on a new ledger and ends
+    once the ledger it agreed on has been built, validated and switched to.
+    Along the way the first proposal received from each validator is
+    timestamped, relative to the start of the round. Proposals that arrived
+    before the round started, and were replayed into it, have negative
+    times.
+
+    The most recent rounds are kept in a bounded history reported by
+    consensus_info, and the durations are also published to insight.
+*/
+class RCLConsensusTimeline
+{
+public:
+    struct Round
+    {
+        //! The ledger built by the round
+        LedgerIndex seq = 0;
+        uint256 hash;
+
+        ConsensusState state = ConsensusState::No;
+        bool proposing = false;
+
+        //! Time from the start of the round to closing the ledger
+        std::chrono::milliseconds open{0};
+
+        //! Time from closing the ledger to reaching consensus
+        std::chrono::milliseconds establish{0};
+
+        //! Timer ticks spent in the establish phase
+        std::size_t establishRounds = 0;
+
+        std::size_t disputes = 0;
+        std::size_t proposers = 0;
+
+        //! Time to apply the agreed transactions and build the ledger
+        std::chrono::milliseconds build{0};
+
+        //! Time to sign and send our validation, if we sent one
+        std::optional<std::chrono::milliseconds> validate;
+
+        //! Time from reaching consensus to opening the next ledger
+        std::chrono::milliseconds accept{0};
+
+        //! When each validator's initial proposal arrived
+        std::vector<std::pair<PublicKey, std::chrono::milliseconds>>
+            proposals;
+    };
+
+    /** Create a timeline.
+
+        @param capacity The number of rounds to remember.
+        @param collector Where to publish the durations of each round.
+    */
+    RCLConsensusTimeline(
+        std::size_t capacity,
+        beast::insight::Collector::ptr const& collector);
+
+    /** Start timing a new round. */
+    void
+    startRound();
+
+    /** Record the arrival of a validator's initial proposal.
+
+        @param validator The validator that sent the proposal.
+        @param id Identifies the proposal if it is replayed later.
+        @param current Whether the current round took the proposal. If it
+                       did not, the arrival is remembered in case a later
+                       round replays the proposal.
+    */
+    void
+    peerProposal(PublicKey const& validator, uint256 const& id, bool current);
+
+    /** Record an initial proposal replayed into the current round.
+
+        The arrival is the time the proposal was first received, if that
+        is still remembered.
+    */
+    void
+    replayedProposal(PublicKey const& validator, uint256 const& id);
+
+    /** Finish the current round and add it to the history.
+
+        The proposals recorded since the round started are moved into
+        `round`; the remaining fields are supplied by the caller.
+    */
+    void
+    endRound(Round&& round);
+
+    /** Return the recorded rounds, oldest first. */
+    Json::Value
+    getJson() const;
+
+private:
+    using clock_type = std::chrono::steady_clock;
+
+    // How many proposals not taken by their round to remember. Consensus
+    // keeps up to ten recent positions from each validator to replay.
+    static constexpr std::size_t maxReceived = 1024;
+
+    void
+    addProposal(PublicKey const& validator, clock_type::time_point arrival);
+
+    std::size_t const capacity_;
+
+    mutable std::mutex mutex_;
+    clock_type::time_point start_;
+    std::vector<std::pair<PublicKey, std::chrono::milliseconds>> proposals_;
+    std::deque<std::pair<uint256, clock_type::time_point>> received_;
+    std::deque<Round> rounds_;
+
+    beast::insight::Event open_;
+    beast::insight::Event establish_;
+    beast::insight::Event build_;
+    beast::insight::Event validate_;
+    beast::insight::Event accept_;
+    beast::insight::Gauge disputes_;
+    beast::insight::Gauge establishRounds_;
+};
+
+}  // namespace ripple
+
+#endif
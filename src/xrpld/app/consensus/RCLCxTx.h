@@ -170,7 +170,7 @@ public:
 
         // Bound the work we do in case of a malicious
         // map_ from a trusted validator
-        map_->compare(*(j.map_), delta, 65536);
+        map_->compareParallel(*(j.map_), delta, 65536);
 
         std::map<uint256, bool> ret;
         for (auto const& [k, v] : delta)
@@ -37,7 +37,7 @@ BookListeners::removeSubscriber(std::uint64_t seq)
 
 void
 BookListeners::publish(
-    MultiApiJson const& jvObj,
+    MultiApiMessage const& msg,
     hash_set<std::uint64_t>& havePublished)
 {
     std::lock_guard sl(mLock);
@@ -52,9 +52,7 @@ BookListeners::publish(
             // Only publish jvObj if this is the first occurence
             if (havePublished.emplace(p->getSeq()).second)
             {
-                jvObj.visit(
-                    p->getApiVersion(),  //
-                    [&](Json::Value const& jv) { p->send(jv, true); });
+                msg.send(*p, true);
             }
             ++it;
         }
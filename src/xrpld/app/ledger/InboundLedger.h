@@ -88,6 +88,12 @@ public:
         return mSeq;
     }
 
+    Reason
+    getReason() const
+    {
+        return mReason;
+    }
+
     bool
     checkLocal();
     void
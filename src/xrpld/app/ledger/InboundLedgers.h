@@ -24,6 +24,9 @@
 
 #include <xrpl/protocol/RippleLedgerHash.h>
 
+#include <memory>
+#include <vector>
+
 namespace ripple {
 
 /** Manages the lifetime of inbound ledgers.
@@ -85,6 +88,17 @@ public:
     virtual void
     onLedgerFetched() = 0;
 
+    /** Returns how many historical ledgers to acquire at once.
+
+        The window grows with the number of peers able to serve the ledger,
+        from the configured ledger fetch size up to several times that, so
+        backfill keeps every such peer busy.
+
+        @param seq The sequence of the ledger to acquire.
+    */
+    virtual std::size_t
+    historyWindow(std::uint32_t seq) = 0;
+
     virtual void
     gotFetchPack() = 0;
     virtual void
@@ -97,6 +111,21 @@ public:
     cacheSize() = 0;
 };
 
+/** Returns how many historical ledgers to acquire at once.
+
+    This is one ledger for each peer able to serve the ledger, but no less
+    than the configured ledger fetch size and no more than several times it.
+
+    @param peers The active peers.
+    @param seq The sequence of the ledger to acquire.
+    @param fetchSize The configured ledger fetch size.
+*/
+std::size_t
+computeHistoryWindow(
+    std::vector<std::shared_ptr<Peer>> const& peers,
+    std::uint32_t seq,
+    std::size_t fetchSize);
+
 std::unique_ptr<InboundLedgers>
 make_InboundLedgers(
     Application& app,
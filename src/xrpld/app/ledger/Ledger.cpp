@@ -33,6 +33,7 @@
 
 #include <xrpl/basics/Log.h>
 #include <xrpl/basics/contract.h>
+#include <xrpl/basics/scope.h>
 #include <xrpl/beast/utility/instrumentation.h>
 #include <xrpl/json/to_string.h>
 #include <xrpl/protocol/Feature.h>
@@ -836,7 +837,10 @@ Ledger::walkLedger(beast::Journal j, bool parallel) const
     else
     {
         if (parallel)
-            return stateMap_.walkMapParallel(missingNodes1, 32);
+        {
+            if (!stateMap_.walkMapParallel(missingNodes1, 32))
+                return false;
+        }
         else
             stateMap_.walkMap(missingNodes1, 32);
     }
@@ -1010,6 +1014,31 @@ saveValidatedLedger(
     return res;
 }
 
+/** Save the ledgers queued for asynchronous saving, in order, until the
+    queue is empty.
+*/
+static bool
+saveQueuedLedgers(Application& app, bool isCurrent)
+{
+    auto& pendingSaves = app.pendingSaves();
+    bool ret = true;
+
+    // If a save throws, that ledger is dropped and the next enqueue() must
+    // start another writer for the ledgers behind it.
+    scope_fail abandon([&pendingSaves, isCurrent]() noexcept {
+        pendingSaves.abandon(isCurrent);
+    });
+
+    while (auto const ledger = pendingSaves.next(isCurrent))
+    {
+        if (!saveValidatedLedger(app, ledger, isCurrent))
+            ret = false;
+        pendingSaves.pop(isCurrent);
+    }
+
+    return ret;
+}
+
 /** Save, or arrange to save, a fully-validated ledger
     Returns false on error
 */
@@ -1047,20 +1076,26 @@ pendSaveValidated(
         return true;
     }
 
+    if (isSynchronous)
+        return saveValidatedLedger(app, ledger, isCurrent);
+
+    // Asynchronous saves are queued and written in order by one job at a
+    // time, rather than by a job per ledger that would all block on the
+    // database.
+    if (!app.pendingSaves().enqueue(ledger, isCurrent))
+        return true;
+
     // See if we can use the JobQueue.
-    if (!isSynchronous &&
-        app.getJobQueue().addJob(
+    if (app.getJobQueue().addJob(
             isCurrent ? jtPUBLEDGER : jtPUBOLDLEDGER,
-            std::to_string(ledger->seq()),
-            [&app, ledger, isCurrent]() {
-                saveValidatedLedger(app, ledger, isCurrent);
-            }))
+            "saveLedgers",
+            [&app, isCurrent]() { saveQueuedLedgers(app, isCurrent); }))
     {
         return true;
     }
 
-    // The JobQueue won't do the Job.  Do the save synchronously.
-    return saveValidatedLedger(app, ledger, isCurrent);
+    // The JobQueue won't do the Job.  Do the saves synchronously.
+    return saveQueuedLedgers(app, isCurrent);
 }
 
 void
@@ -27,7 +27,8 @@
 
 namespace ripple {
 
-// FIXME: Need to clean up ledgers by index at some point
+// The number of recent validated ledgers whose hashes are indexed
+static constexpr std::size_t indexCapacity = 32768;
 
 LedgerHistory::LedgerHistory(
     beast::insight::Collector::ptr const& collector,
@@ -47,6 +48,8 @@ LedgerHistory::LedgerHistory(
           std::chrono::minutes{5},
           stopwatch(),
           app_.journal("TaggedCache"))
+    , mLedgersByIndex(indexCapacity)
+    , maxCachedBytes_(app_.config().LEDGER_CACHE_BYTES)
     , j_(app.journal("LedgerHistory"))
 {
 }
@@ -68,7 +71,10 @@ LedgerHistory::insert(
     bool const alreadyHad = m_ledgers_by_hash.canonicalize_replace_cache(
         ledger->info().hash, ledger);
     if (validated)
-        mLedgersByIndex[ledger->info().seq] = ledger->info().hash;
+        setIndex(ledger->info().seq, ledger->info().hash);
+
+    sl.unlock();
+    track(ledger);
 
     return alreadyHad;
 }
@@ -77,25 +83,17 @@ LedgerHash
 LedgerHistory::getLedgerHash(LedgerIndex index)
 {
     std::unique_lock sl(m_ledgers_by_hash.peekMutex());
-    if (auto it = mLedgersByIndex.find(index); it != mLedgersByIndex.end())
-        return it->second;
+    auto const& [seq, hash] = mLedgersByIndex[index % mLedgersByIndex.size()];
+    if (seq == index)
+        return hash;
     return {};
 }
 
 std::shared_ptr<Ledger const>
 LedgerHistory::getLedgerBySeq(LedgerIndex index)
 {
-    {
-        std::unique_lock sl(m_ledgers_by_hash.peekMutex());
-        auto it = mLedgersByIndex.find(index);
-
-        if (it != mLedgersByIndex.end())
-        {
-            uint256 hash = it->second;
-            sl.unlock();
-            return getLedgerByHash(hash);
-        }
-    }
+    if (auto const hash = getLedgerHash(index); hash.isNonZero())
+        return getLedgerByHash(hash);
 
     std::shared_ptr<Ledger const> ret = loadByIndex(index, app_);
 
@@ -114,9 +112,11 @@ LedgerHistory::getLedgerBySeq(LedgerIndex index)
             ret->isImmutable(),
             "ripple::LedgerHistory::getLedgerBySeq : immutable result ledger");
         m_ledgers_by_hash.canonicalize_replace_client(ret->info().hash, ret);
-        mLedgersByIndex[ret->info().seq] = ret->info().hash;
-        return (ret->info().seq == index) ? ret : nullptr;
+        setIndex(ret->info().seq, ret->info().hash);
     }
+
+    track(ret);
+    return (ret->info().seq == index) ? ret : nullptr;
 }
 
 std::shared_ptr<Ledger const>
@@ -134,6 +134,9 @@ LedgerHistory::getLedgerByHash(LedgerHash const& hash)
             ret->info().hash == hash,
             "ripple::LedgerHistory::getLedgerByHash : fetched ledger hash "
             "match");
+        // The fetch returns a released ledger to the cache, so charge it
+        // again.
+        track(ret);
         return ret;
     }
 
@@ -153,9 +156,112 @@ LedgerHistory::getLedgerByHash(LedgerHash const& hash)
         ret->info().hash == hash,
         "ripple::LedgerHistory::getLedgerByHash : result hash match");
 
+    track(ret);
     return ret;
 }
 
+std::size_t
+LedgerHistory::getCacheBytes()
+{
+    std::unique_lock sl(m_ledgers_by_hash.peekMutex());
+    return cachedBytes_;
+}
+
+std::uint64_t
+LedgerHistory::getCacheEvictions()
+{
+    std::unique_lock sl(m_ledgers_by_hash.peekMutex());
+    return evictions_;
+}
+
+void
+LedgerHistory::sweep()
+{
+    m_ledgers_by_hash.sweep();
+    m_consensus_validated.sweep();
+
+    // Stop charging for ledgers that are no longer in memory
+    std::unique_lock sl(m_ledgers_by_hash.peekMutex());
+    for (auto it = cachedLedgers_.begin(); it != cachedLedgers_.end();)
+    {
+        if (it->second.ledger.expired())
+        {
+            cachedBytes_ -= it->second.bytes;
+            it = cachedLedgers_.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void
+LedgerHistory::track(std::shared_ptr<Ledger const> const& ledger)
+{
+    auto const key = std::make_pair(ledger->info().seq, ledger->info().hash);
+
+    // Charge the ledger only for the state it doesn't share with the most
+    // recent older ledger we hold, which is usually its parent.
+    std::shared_ptr<Ledger const> base;
+    {
+        std::unique_lock sl(m_ledgers_by_hash.peekMutex());
+        if (cachedLedgers_.count(key) != 0)
+            return;
+
+        if (maxCachedBytes_ != 0 && cachedBytes_ >= maxCachedBytes_ &&
+            !cachedLedgers_.empty() && key < cachedLedgers_.begin()->first)
+        {
+            // It would be the first ledger released, so release it now
+            // rather than walk its maps.
+            m_ledgers_by_hash.del(key.second, true);
+            ++evictions_;
+            return;
+        }
+
+        auto it = cachedLedgers_.lower_bound({key.first, LedgerHash{}});
+        while (!base && it != cachedLedgers_.begin())
+            base = (--it)->second.ledger.lock();
+    }
+
+    // Walk the maps without the lock, since the first ledger held is charged
+    // for all of its state.
+    auto const bytes = ledger->txMap().getMemoryFootprint(nullptr) +
+        ledger->stateMap().getMemoryFootprint(
+            base ? &base->stateMap() : nullptr);
+
+    std::unique_lock sl(m_ledgers_by_hash.peekMutex());
+    if (!cachedLedgers_.emplace(key, CachedLedger{bytes, ledger}).second)
+        return;
+    cachedBytes_ += bytes;
+
+    if (maxCachedBytes_ == 0)
+        return;
+
+    // Release the oldest ledgers from the cache. Any that are still in use
+    // stay in memory, and can still be found, until they are released.
+    while (cachedBytes_ > maxCachedBytes_ && cachedLedgers_.size() > 1)
+    {
+        auto const oldest = cachedLedgers_.begin();
+        m_ledgers_by_hash.del(oldest->first.second, true);
+        cachedBytes_ -= oldest->second.bytes;
+        cachedLedgers_.erase(oldest);
+        ++evictions_;
+    }
+
+    JLOG(j_.trace()) << "Ledger cache holds " << cachedLedgers_.size()
+                     << " ledgers in about " << cachedBytes_ << " bytes";
+}
+
+void
+LedgerHistory::setIndex(LedgerIndex ledgerIndex, LedgerHash const& ledgerHash)
+{
+    // The most recent of the ledgers sharing a slot keeps it
+    auto& entry = mLedgersByIndex[ledgerIndex % mLedgersByIndex.size()];
+    if (entry.first <= ledgerIndex)
+        entry = {ledgerIndex, ledgerHash};
+}
+
 static void
 log_one(
     ReadView const& ledger,
@@ -536,11 +642,11 @@ bool
 LedgerHistory::fixIndex(LedgerIndex ledgerIndex, LedgerHash const& ledgerHash)
 {
     std::unique_lock sl(m_ledgers_by_hash.peekMutex());
-    auto it = mLedgersByIndex.find(ledgerIndex);
+    auto& entry = mLedgersByIndex[ledgerIndex % mLedgersByIndex.size()];
 
-    if ((it != mLedgersByIndex.end()) && (it->second != ledgerHash))
+    if ((entry.first == ledgerIndex) && (entry.second != ledgerHash))
     {
-        it->second = ledgerHash;
+        entry.second = ledgerHash;
         return false;
     }
     return true;
@@ -555,6 +661,14 @@ LedgerHistory::clearLedgerCachePrior(LedgerIndex seq)
         if (!ledger || ledger->info().seq < seq)
             m_ledgers_by_hash.del(it, false);
     }
+
+    std::unique_lock sl(m_ledgers_by_hash.peekMutex());
+    auto const end = cachedLedgers_.lower_bound({seq, LedgerHash{}});
+    for (auto it = cachedLedgers_.begin(); it != end;)
+    {
+        cachedBytes_ -= it->second.bytes;
+        it = cachedLedgers_.erase(it);
+    }
 }
 
 }  // namespace ripple
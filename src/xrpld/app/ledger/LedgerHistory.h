@@ -26,7 +26,10 @@
 #include <xrpl/beast/insight/Collector.h>
 #include <xrpl/protocol/RippleLedgerHash.h>
 
+#include <map>
 #include <optional>
+#include <utility>
+#include <vector>
 
 namespace ripple {
 
@@ -55,6 +58,15 @@ public:
         return m_ledgers_by_hash.getHitRate();
     }
 
+    /** Get the approximate bytes held by the cached ledgers */
+    std::size_t
+    getCacheBytes();
+
+    /** Get the number of ledgers released to keep within the memory budget
+     */
+    std::uint64_t
+    getCacheEvictions();
+
     /** Get a ledger given its sequence number */
     std::shared_ptr<Ledger const>
     getLedgerBySeq(LedgerIndex ledgerIndex);
@@ -73,11 +85,7 @@ public:
     /** Remove stale cache entries
      */
     void
-    sweep()
-    {
-        m_ledgers_by_hash.sweep();
-        m_consensus_validated.sweep();
-    }
+    sweep();
 
     /** Report that we have locally built a particular ledger */
     void
@@ -122,6 +130,16 @@ private:
         std::optional<uint256> const& validatedConsensusHash,
         Json::Value const& consensus);
 
+    /** Charge a cached ledger against the memory budget, and release the
+        oldest ledgers from the cache if the budget is exceeded.
+    */
+    void
+    track(std::shared_ptr<Ledger const> const& ledger);
+
+    /** Record the hash of a validated ledger in the index */
+    void
+    setIndex(LedgerIndex ledgerIndex, LedgerHash const& ledgerHash);
+
     Application& app_;
     beast::insight::Collector::ptr collector_;
     beast::insight::Counter mismatch_counter_;
@@ -148,8 +166,20 @@ private:
     using ConsensusValidated = TaggedCache<LedgerIndex, cv_entry>;
     ConsensusValidated m_consensus_validated;
 
-    // Maps ledger indexes to the corresponding hash.
-    std::map<LedgerIndex, LedgerHash> mLedgersByIndex;  // validated ledgers
+    // Maps the indexes of recent validated ledgers to their hashes. Each
+    // index has one slot in the ring, which the most recent ledger keeps.
+    std::vector<std::pair<LedgerIndex, LedgerHash>> mLedgersByIndex;
+
+    // The approximate bytes held by each cached ledger, oldest first
+    struct CachedLedger
+    {
+        std::size_t bytes;
+        std::weak_ptr<Ledger const> ledger;
+    };
+    std::map<std::pair<LedgerIndex, LedgerHash>, CachedLedger> cachedLedgers_;
+    std::size_t cachedBytes_ = 0;
+    std::size_t const maxCachedBytes_;
+    std::uint64_t evictions_ = 0;
 
     beast::Journal j_;
 };
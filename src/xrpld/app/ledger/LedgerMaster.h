@@ -202,6 +202,10 @@ public:
     sweep();
     float
     getCacheHitRate();
+    std::size_t
+    getCacheBytes();
+    std::uint64_t
+    getCacheEvictions();
 
     void
     checkAccept(std::shared_ptr<Ledger const> const& ledger);
@@ -162,12 +162,20 @@ private:
     trigger(ScopedLockType& sl);
 
     /**
-     * Try to build more ledgers
+     * Try to build more ledgers, on a job so the caller is not held up
      * @param sl  lock. this function must be called with the lock
      */
     void
     tryAdvance(ScopedLockType& sl);
 
+    /**
+     * Build ledgers in order for as long as their deltas are ready
+     * @note only one job builds at a time, and the lock is released while
+     *       each ledger is built
+     */
+    void
+    build();
+
     InboundLedgers& inboundLedgers_;
     LedgerReplayer& replayer_;
     TaskParameter parameter_;
@@ -176,6 +184,8 @@ private:
     std::shared_ptr<Ledger const> parent_ = {};
     uint32_t deltaToBuild_ = 0;  // should not build until have parent
     std::vector<std::shared_ptr<LedgerDeltaAcquire>> deltas_;
+    bool building_ = false;
+    bool buildAgain_ = false;
 
     friend class test::LedgerReplayClient;
 };
@@ -294,7 +294,7 @@ void
 OrderBookDB::processTxn(
     std::shared_ptr<ReadView const> const& ledger,
     AcceptedLedgerTx const& alTx,
-    MultiApiJson const& jvObj)
+    MultiApiMessage const& msg)
 {
     std::lock_guard sl(mLock);
 
@@ -322,7 +322,7 @@ OrderBookDB::processTxn(
                              data->getFieldAmount(sfTakerPays).issue(),
                              (*data)[~sfDomainID]});
                         if (listeners)
-                            listeners->publish(jvObj, havePublished);
+                            listeners->publish(msg, havePublished);
                     }
                 };
 
@@ -72,7 +72,7 @@ public:
     processTxn(
         std::shared_ptr<ReadView const> const& ledger,
         AcceptedLedgerTx const& alTx,
-        MultiApiJson const& jvObj);
+        MultiApiMessage const& msg);
 
 private:
     Application& app_;
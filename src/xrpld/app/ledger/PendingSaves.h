@@ -22,12 +22,19 @@
 
 #include <xrpl/protocol/Protocol.h>
 
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <utility>
 
 namespace ripple {
 
+class Ledger;
+
 /** Keeps track of which ledgers haven't been fully saved.
 
     During the ledger building process this collection will keep
@@ -36,10 +43,25 @@ namespace ripple {
 */
 class PendingSaves
 {
+public:
+    using clock_type = std::chrono::steady_clock;
+
 private:
+    // Asynchronous saves waiting for the writer job. Current and historical
+    // ledgers are queued separately so each keeps its own job priority.
+    struct Queue
+    {
+        std::deque<
+            std::pair<std::shared_ptr<Ledger const>, clock_type::time_point>>
+            ledgers;
+        bool draining = false;
+    };
+
     std::mutex mutable mutex_;
     std::map<LedgerIndex, bool> map_;
     std::condition_variable await_;
+    Queue current_;
+    Queue old_;
 
 public:
     /** Start working on a ledger
@@ -128,6 +150,107 @@ public:
         } while (true);
     }
 
+    /** Queue a ledger to be saved asynchronously
+
+        The queue is drained in order by a single writer, so that a backlog
+        of saves occupies one job rather than one job per ledger, all
+        contending for the database.
+
+        @return 'true' if no writer is draining the queue, in which case the
+                caller must arrange for drain() to be called.
+    */
+    bool
+    enqueue(std::shared_ptr<Ledger const> const& ledger, bool isCurrent)
+    {
+        std::lock_guard lock(mutex_);
+
+        auto& queue = isCurrent ? current_ : old_;
+        queue.ledgers.emplace_back(ledger, clock_type::now());
+
+        if (queue.draining)
+            return false;
+
+        queue.draining = true;
+        return true;
+    }
+
+    /** Return the next ledger for the writer to save
+
+        The ledger stays queued, and counted by queued() and queueAge(),
+        until the writer has saved it and calls pop(). Once the queue is
+        found empty the writer is considered finished and the next
+        enqueue() must start another.
+
+        @return The oldest queued ledger, or nullptr if there is none.
+    */
+    std::shared_ptr<Ledger const>
+    next(bool isCurrent)
+    {
+        std::lock_guard lock(mutex_);
+
+        auto& queue = isCurrent ? current_ : old_;
+        if (queue.ledgers.empty())
+        {
+            queue.draining = false;
+            return {};
+        }
+        return queue.ledgers.front().first;
+    }
+
+    /** Remove the ledger returned by next() once the writer is done. */
+    void
+    pop(bool isCurrent)
+    {
+        std::lock_guard lock(mutex_);
+
+        auto& queue = isCurrent ? current_ : old_;
+        if (!queue.ledgers.empty())
+            queue.ledgers.pop_front();
+    }
+
+    /** Stop draining after the writer failed
+
+        The ledger the writer failed to save is dropped. The ledgers
+        behind it are left for the writer that the next enqueue() starts.
+    */
+    void
+    abandon(bool isCurrent)
+    {
+        std::lock_guard lock(mutex_);
+
+        auto& queue = isCurrent ? current_ : old_;
+        if (!queue.ledgers.empty())
+            queue.ledgers.pop_front();
+        queue.draining = false;
+    }
+
+    /** Return the number of ledgers queued and not yet saved. */
+    std::size_t
+    queued() const
+    {
+        std::lock_guard lock(mutex_);
+        return current_.ledgers.size() + old_.ledgers.size();
+    }
+
+    /** Return how long the oldest unsaved queued ledger has waited. */
+    std::optional<clock_type::duration>
+    queueAge() const
+    {
+        std::lock_guard lock(mutex_);
+
+        std::optional<clock_type::time_point> oldest;
+        for (auto const* queue : {&current_, &old_})
+        {
+            if (!queue->ledgers.empty() &&
+                (!oldest || queue->ledgers.front().second < *oldest))
+                oldest = queue->ledgers.front().second;
+        }
+
+        if (!oldest)
+            return std::nullopt;
+        return clock_type::now() - *oldest;
+    }
+
     /** Get a snapshot of the pending saves
 
         Each entry in the returned map corresponds to a ledger
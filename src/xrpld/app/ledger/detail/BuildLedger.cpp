@@ -33,6 +33,11 @@ namespace ripple {
    It is responsible for adding transactions to the open view to generate the
    new ledger. It is generic since the mechanics differ for consensus
    generated ledgers versus replayed ledgers.
+
+   The state map of a replayed ledger is flushed on several threads, since
+   catching up replays ledger after ledger. A consensus ledger is flushed
+   on the calling thread, which holds up consensus for less than starting
+   the threads would.
 */
 template <class ApplyTxs>
 std::shared_ptr<Ledger>
@@ -43,6 +48,7 @@ buildLedgerImpl(
     NetClock::duration closeResolution,
     Application& app,
     beast::Journal j,
+    bool parallelFlush,
     ApplyTxs&& applyTxs)
 {
     auto built = std::make_shared<Ledger>(*parent, closeTime);
@@ -68,7 +74,9 @@ buildLedgerImpl(
         // Write the final version of all modified SHAMap
         // nodes to the node store to preserve the new LCL
 
-        int const asf = built->stateMap().flushDirty(hotACCOUNT_NODE);
+        int const asf = parallelFlush
+            ? built->stateMap().flushDirtyParallel(hotACCOUNT_NODE)
+            : built->stateMap().flushDirty(hotACCOUNT_NODE);
         int const tmf = built->txMap().flushDirty(hotTRANSACTION_NODE);
         JLOG(j.debug()) << "Flushed " << asf << " accounts and " << tmf
                         << " transaction nodes";
@@ -200,6 +208,7 @@ buildLedger(
         closeResolution,
         app,
         j,
+        false,
         [&](OpenView& accum, std::shared_ptr<Ledger> const& built) {
             JLOG(j.debug())
                 << "Attempting to apply " << txns.size() << " transactions";
@@ -241,6 +250,7 @@ buildLedger(
         replayLedger->info().closeTimeResolution,
         app,
         j,
+        true,
         [&](OpenView& accum, std::shared_ptr<Ledger> const& built) {
             for (auto& tx : replayData.orderedTxns())
                 applyTransaction(app, accum, *tx.second, false, applyFlags, j);
@@ -21,7 +21,9 @@
 #include <xrpld/app/ledger/LedgerMaster.h>
 #include <xrpld/app/main/Application.h>
 #include <xrpld/app/misc/NetworkOPs.h>
+#include <xrpld/core/Config.h>
 #include <xrpld/core/JobQueue.h>
+#include <xrpld/overlay/Overlay.h>
 #include <xrpld/perflog/PerfLog.h>
 
 #include <xrpl/basics/DecayingSample.h>
@@ -30,6 +32,8 @@
 #include <xrpl/beast/container/aged_map.h>
 #include <xrpl/protocol/jss.h>
 
+#include <algorithm>
+#include <atomic>
 #include <exception>
 #include <memory>
 #include <mutex>
@@ -315,6 +319,17 @@ public:
         fetchRate_.add(1, m_clock.now());
     }
 
+    std::size_t
+    historyWindow(std::uint32_t seq) override
+    {
+        auto const window = computeHistoryWindow(
+            app_.overlay().getActivePeers(),
+            seq,
+            app_.config().getValueFor(SizedItem::ledgerFetch));
+        historyWindow_ = window;
+        return window;
+    }
+
     Json::Value
     getInfo() override
     {
@@ -342,8 +357,13 @@ public:
             }
         }
 
+        std::size_t historyInFlight = 0;
         for (auto const& it : acqs)
         {
+            if (it.second->getReason() == InboundLedger::Reason::HISTORY &&
+                !it.second->isComplete() && !it.second->isFailed())
+                ++historyInFlight;
+
             // getJson is expensive, so call without the lock
             std::uint32_t seq = it.second->getSeq();
             if (seq > 1)
@@ -352,6 +372,12 @@ public:
                 ret[to_string(it.first)] = it.second->getJson(0);
         }
 
+        Json::Value& history = ret[jss::history] = Json::objectValue;
+        history[jss::historical_perminute] =
+            static_cast<Json::UInt>(fetchRate());
+        history[jss::in_flight] = static_cast<Json::UInt>(historyInFlight);
+        history[jss::window] = static_cast<Json::UInt>(historyWindow_.load());
+
         return ret;
     }
 
@@ -463,10 +489,32 @@ private:
 
     std::set<uint256> pendingAcquires_;
     std::mutex acquiresMutex_;
+
+    // The most recent history window, for reporting
+    std::atomic<std::size_t> historyWindow_{0};
 };
 
 //------------------------------------------------------------------------------
 
+std::size_t
+computeHistoryWindow(
+    std::vector<std::shared_ptr<Peer>> const& peers,
+    std::uint32_t seq,
+    std::size_t fetchSize)
+{
+    // How many times the fetch size the window may grow to when enough
+    // peers can serve the ledgers
+    static constexpr std::size_t maxFactor = 4;
+
+    auto const able = std::count_if(
+        peers.begin(), peers.end(), [seq](auto const& peer) {
+            return peer->hasRange(seq, seq);
+        });
+
+    return std::clamp(
+        static_cast<std::size_t>(able), fetchSize, fetchSize * maxFactor);
+}
+
 std::unique_ptr<InboundLedgers>
 make_InboundLedgers(
     Application& app,
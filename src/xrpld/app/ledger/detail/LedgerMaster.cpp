@@ -1795,6 +1795,18 @@ LedgerMaster::getCacheHitRate()
     return mLedgerHistory.getCacheHitRate();
 }
 
+std::size_t
+LedgerMaster::getCacheBytes()
+{
+    return mLedgerHistory.getCacheBytes();
+}
+
+std::uint64_t
+LedgerMaster::getCacheEvictions()
+{
+    return mLedgerHistory.getCacheEvictions();
+}
+
 void
 LedgerMaster::clearPriorLedgers(LedgerIndex seq)
 {
@@ -1889,12 +1901,17 @@ LedgerMaster::fetchForHistory(
         }
         else
         {
+            // Keep as many ledgers in flight as the peers that can serve
+            // them allow
+            std::uint32_t const window = static_cast<std::uint32_t>(
+                app_.getInboundLedgers().historyWindow(missing));
+
             std::uint32_t fetchSz;
             // Do not fetch ledger sequences lower
             // than the earliest ledger sequence
             fetchSz = app_.getNodeStore().earliestLedgerSeq();
             fetchSz = missing >= fetchSz
-                ? std::min(ledger_fetch_size_, (missing - fetchSz) + 1)
+                ? std::min(window, (missing - fetchSz) + 1)
                 : 0;
             try
             {
@@ -22,6 +22,7 @@
 #include <xrpld/app/ledger/LedgerReplayer.h>
 #include <xrpld/app/ledger/detail/LedgerDeltaAcquire.h>
 #include <xrpld/app/ledger/detail/SkipListAcquire.h>
+#include <xrpld/core/JobQueue.h>
 
 namespace ripple {
 
@@ -199,33 +200,72 @@ LedgerReplayTask::tryAdvance(ScopedLockType& sl)
     if (!shouldTry)
         return;
 
-    try
+    // The job already building will pick up the new delta
+    if (building_)
     {
-        for (; deltaToBuild_ < deltas_.size(); ++deltaToBuild_)
+        buildAgain_ = true;
+        return;
+    }
+
+    std::weak_ptr<LedgerReplayTask> wptr = shared_from_this();
+    building_ = app_.getJobQueue().addJob(
+        jtREPLAY_TASK, "LedgerReplayTask::build", [wptr]() {
+            if (auto sptr = wptr.lock(); sptr)
+                sptr->build();
+        });
+}
+
+void
+LedgerReplayTask::build()
+{
+    ScopedLockType sl(mtx_);
+    while (!isDone())
+    {
+        buildAgain_ = false;
+        if (deltaToBuild_ == deltas_.size())
         {
-            auto& delta = deltas_[deltaToBuild_];
-            XRPL_ASSERT(
-                parent_->seq() + 1 == delta->ledgerSeq_,
-                "ripple::LedgerReplayTask::tryAdvance : consecutive sequence");
-            if (auto l = delta->tryBuild(parent_); l)
-            {
-                JLOG(journal_.debug())
-                    << "Task " << hash_ << " got ledger " << l->info().hash
-                    << " deltaIndex=" << deltaToBuild_
-                    << " totalDeltas=" << deltas_.size();
-                parent_ = l;
-            }
-            else
-                return;
+            complete_ = true;
+            JLOG(journal_.info()) << "Completed " << hash_;
+            break;
         }
 
-        complete_ = true;
-        JLOG(journal_.info()) << "Completed " << hash_;
-    }
-    catch (std::runtime_error const&)
-    {
-        failed_ = true;
+        auto const delta = deltas_[deltaToBuild_];
+        auto const parent = parent_;
+        XRPL_ASSERT(
+            parent->seq() + 1 == delta->ledgerSeq_,
+            "ripple::LedgerReplayTask::build : consecutive sequence");
+
+        // Build without the lock, so that deltas arriving meanwhile are not
+        // held up behind the transactions being applied.
+        std::shared_ptr<Ledger const> l;
+        sl.unlock();
+        try
+        {
+            l = delta->tryBuild(parent);
+        }
+        catch (std::runtime_error const&)
+        {
+            sl.lock();
+            failed_ = true;
+            break;
+        }
+        sl.lock();
+
+        if (!l)
+        {
+            if (buildAgain_)
+                continue;
+            break;
+        }
+
+        JLOG(journal_.debug())
+            << "Task " << hash_ << " got ledger " << l->info().hash
+            << " deltaIndex=" << deltaToBuild_
+            << " totalDeltas=" << deltas_.size();
+        parent_ = l;
+        ++deltaToBuild_;
     }
+    building_ = false;
 }
 
 void
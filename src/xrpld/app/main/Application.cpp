@@ -36,6 +36,7 @@
 #include <xrpld/app/main/NodeIdentity.h>
 #include <xrpld/app/main/NodeStoreScheduler.h>
 #include <xrpld/app/misc/AmendmentTable.h>
+#include <xrpld/app/misc/CacheSnapshot.h>
 #include <xrpld/app/misc/ExclusionManager.h>
 #include <xrpld/app/misc/ValidatorExclusionManager.h>
 #include <xrpld/app/misc/ValidatorVoteTracker.h>
@@ -202,6 +203,8 @@ public:
     std::unique_ptr<InboundTransactions> m_inboundTransactions;
     std::unique_ptr<LedgerReplayer> m_ledgerReplayer;
     TaggedCache<uint256, AcceptedLedger> m_acceptedLedgerCache;
+    CachedLedgerData ledgerDataCache_;
+    CacheSnapshot cacheSnapshot_;
     std::unique_ptr<NetworkOPs> m_networkOPs;
     std::unique_ptr<Cluster> cluster_;
     std::unique_ptr<PeerReservationTable> peerReservations_;
@@ -274,7 +277,10 @@ public:
         std::unique_ptr<Config> config,
         std::unique_ptr<Logs> logs,
         std::unique_ptr<TimeKeeper> timeKeeper)
-        : BasicApp(numberOfThreads(*config))
+        : BasicApp(
+              numberOfThreads(*config),
+              config->IO_WORKERS_CPUS,
+              logs->journal("Application"))
         , config_(std::move(config))
         , logs_(std::move(logs))
         , timeKeeper_(std::move(timeKeeper))
@@ -326,9 +332,10 @@ public:
               m_collectorManager->group("jobq"),
               logs_->journal("JobQueue"),
               *logs_,
-              *perfLog_))
+              *perfLog_,
+              config_->WORKERS_CPUS))
 
-        , m_nodeStoreScheduler(*m_jobQueue)
+        , m_nodeStoreScheduler(*m_jobQueue, m_collectorManager->collector())
 
         , m_shaMapStore(make_SHAMapStore(
               *this,
@@ -403,6 +410,18 @@ public:
               stopwatch(),
               logs_->journal("TaggedCache"))
 
+        , ledgerDataCache_(
+              "LedgerData",
+              128,
+              std::chrono::minutes{2},
+              stopwatch(),
+              logs_->journal("TaggedCache"))
+
+        , cacheSnapshot_(
+              *this,
+              config_->CACHE_SNAPSHOT,
+              logs_->journal("CacheSnapshot"))
+
         , m_networkOPs(make_NetworkOPs(
               *this,
               stopwatch(),
@@ -460,8 +479,10 @@ public:
 
         , m_loadManager(make_LoadManager(*this, logs_->journal("LoadManager")))
 
-        , txQ_(
-              std::make_unique<TxQ>(setup_TxQ(*config_), logs_->journal("TxQ")))
+        , txQ_(std::make_unique<TxQ>(
+              setup_TxQ(*config_),
+              m_collectorManager->collector(),
+              logs_->journal("TxQ")))
 
         , sweepTimer_(get_io_service())
 
@@ -649,6 +670,12 @@ public:
         return m_acceptedLedgerCache;
     }
 
+    CachedLedgerData&
+    getLedgerDataCache() override
+    {
+        return ledgerDataCache_;
+    }
+
     void
     gotTXSet(std::shared_ptr<SHAMap> const& set, bool fromAcquire)
     {
@@ -1142,6 +1169,15 @@ public:
                 << oldAcceptedLedgerSize
                 << "; size after: " << m_acceptedLedgerCache.size();
         }
+        {
+            std::size_t const oldLedgerDataSize = ledgerDataCache_.size();
+
+            ledgerDataCache_.sweep();
+
+            JLOG(m_journal.debug())
+                << "LedgerDataCache sweep.  Size before: " << oldLedgerDataSize
+                << "; size after: " << ledgerDataCache_.size();
+        }
         {
             std::size_t const oldCachedSLEsSize = cachedSLEs_.size();
 
@@ -1152,6 +1188,10 @@ public:
                 << "; size after: " << cachedSLEs_.size();
         }
 
+        // Refresh the keys saved for a warm restart now that the caches
+        // hold only what is still in use.
+        cacheSnapshot_.onSweep();
+
         // Set timer to do another sweep later.
         setSweepTimer();
     }
@@ -1371,6 +1411,8 @@ ApplicationImp::setup(boost::program_options::variables_map const& cmdline)
             forcedRange->first, forcedRange->second);
     }
 
+    cacheSnapshot_.load();
+
     m_orderBookDB.setup(getLedgerMaster().getCurrentLedger());
 
     nodeIdentity_ = getNodeIdentity(*this, cmdline);
@@ -1680,6 +1722,8 @@ ApplicationImp::run()
             return validators().trustedPublisher(pubKey);
         });
 
+    cacheSnapshot_.save();
+
     // The order of these stop calls is delicate.
     // Re-ordering them risks undefined behavior.
     m_loadManager->stop();
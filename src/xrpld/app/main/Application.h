@@ -26,6 +26,7 @@
 
 #include <xrpl/basics/TaggedCache.h>
 #include <xrpl/beast/utility/PropertyStream.h>
+#include <xrpl/json/json_value.h>
 #include <xrpl/protocol/Protocol.h>
 
 #include <boost/asio.hpp>
@@ -68,6 +69,9 @@ class STLedgerEntry;
 using SLE = STLedgerEntry;
 using CachedSLEs = TaggedCache<uint256, SLE const>;
 
+/** Pages of ledger_data for closed ledgers, ready to be sent. */
+using CachedLedgerData = TaggedCache<uint256, Json::Value const>;
+
 class CollectorManager;
 class Family;
 class HashRouter;
@@ -221,6 +225,8 @@ public:
 
     virtual TaggedCache<uint256, AcceptedLedger>&
     getAcceptedLedgerCache() = 0;
+    virtual CachedLedgerData&
+    getLedgerDataCache() = 0;
 
     virtual LedgerMaster&
     getLedgerMaster() = 0;
@@ -19,18 +19,29 @@
 
 #include <xrpld/app/main/BasicApp.h>
 
+#include <xrpl/basics/Log.h>
+#include <xrpl/beast/core/CurrentThreadAffinity.h>
 #include <xrpl/beast/core/CurrentThreadName.h>
 
-BasicApp::BasicApp(std::size_t numberOfThreads)
+BasicApp::BasicApp(
+    std::size_t numberOfThreads,
+    std::vector<unsigned> const& cpus,
+    beast::Journal journal)
 {
     work_.emplace(io_service_);
     threads_.reserve(numberOfThreads);
 
     while (numberOfThreads--)
     {
-        threads_.emplace_back([this, numberOfThreads]() {
+        threads_.emplace_back([this, numberOfThreads, cpus, journal]() {
             beast::setCurrentThreadName(
                 "io svc #" + std::to_string(numberOfThreads));
+            if (!beast::setCurrentThreadAffinity(cpus) &&
+                !affinityFailed_.exchange(true))
+            {
+                JLOG(journal.warn()) << "Unable to pin the io svc threads to "
+                                        "the configured processors";
+            }
             this->io_service_.run();
         });
     }
@@ -20,8 +20,11 @@
 #ifndef RIPPLE_APP_BASICAPP_H_INCLUDED
 #define RIPPLE_APP_BASICAPP_H_INCLUDED
 
+#include <xrpl/beast/utility/Journal.h>
+
 #include <boost/asio/io_service.hpp>
 
+#include <atomic>
 #include <optional>
 #include <thread>
 #include <vector>
@@ -33,9 +36,13 @@ private:
     std::optional<boost::asio::io_service::work> work_;
     std::vector<std::thread> threads_;
     boost::asio::io_service io_service_;
+    std::atomic<bool> affinityFailed_{false};
 
 public:
-    BasicApp(std::size_t numberOfThreads);
+    BasicApp(
+        std::size_t numberOfThreads,
+        std::vector<unsigned> const& cpus = {},
+        beast::Journal journal = beast::Journal{beast::Journal::getNullSink()});
     ~BasicApp();
 
     boost::asio::io_service&
@@ -19,6 +19,9 @@
 
 #include <xrpld/app/main/CollectorManager.h>
 
+#include <xrpl/basics/Log.h>
+
+#include <cstdint>
 #include <memory>
 
 namespace ripple {
@@ -26,6 +29,9 @@ namespace ripple {
 class CollectorManagerImp : public CollectorManager
 {
 public:
+    static constexpr std::uint16_t defaultPrometheusPort = 9201;
+
+
     beast::Journal m_journal;
     beast::insight::Collector::ptr m_collector;
     std::unique_ptr<beast::insight::Groups> m_groups;
@@ -44,6 +50,28 @@ public:
             m_collector =
                 beast::insight::StatsDCollector::New(address, prefix, journal);
         }
+        else if (server == "prometheus")
+        {
+            // Metrics are served unauthenticated, so by default only to
+            // this host, on a known port
+            auto address = beast::IP::Endpoint::from_string_checked(
+                get(params, "address", "127.0.0.1"));
+            if (address && address->port() == 0)
+                address = address->at_port(defaultPrometheusPort);
+            std::string const& prefix(get(params, "prefix"));
+
+            if (address)
+            {
+                m_collector = beast::insight::PrometheusCollector::New(
+                    *address, prefix, journal);
+            }
+            else
+            {
+                JLOG(m_journal.error())
+                    << "Invalid [insight] address: " << get(params, "address");
+                m_collector = beast::insight::NullCollector::New();
+            }
+        }
         else
         {
             m_collector = beast::insight::NullCollector::New();
@@ -104,7 +104,7 @@ inline constexpr std::array<char const*, 8> TxDBInit{
 
 inline constexpr auto WalletDBName{"wallet.db"};
 
-inline constexpr std::array<char const*, 6> WalletDBInit{
+inline constexpr std::array<char const*, 7> WalletDBInit{
     {"BEGIN TRANSACTION;",
 
      // A node's identity must be persisted, including
@@ -133,6 +133,14 @@ inline constexpr std::array<char const*, 6> WalletDBInit{
         RawData          BLOB NOT NULL					\
     );",
 
+     // Keys of the hottest cache entries, used to warm the
+     // caches when the server restarts. Holds at most one row.
+     "CREATE TABLE IF NOT EXISTS CacheSnapshot (			\
+        LastRotated     BIGINT UNSIGNED NOT NULL,		\
+        Ledgers         BLOB NOT NULL,					\
+        InnerNodes      BLOB NOT NULL					\
+    );",
+
      "END TRANSACTION;"}};
 
 }  // namespace ripple
@@ -21,10 +21,30 @@
 
 namespace ripple {
 
-NodeStoreScheduler::NodeStoreScheduler(JobQueue& jobQueue) : jobQueue_(jobQueue)
+NodeStoreScheduler::NodeStoreScheduler(
+    JobQueue& jobQueue,
+    beast::insight::Collector::ptr const& collector)
+    : jobQueue_(jobQueue)
+    , stats_(std::bind(&NodeStoreScheduler::collectMetrics, this), collector)
 {
 }
 
+void
+NodeStoreScheduler::collectMetrics()
+{
+    auto const publish = [](beast::insight::Counter& counter,
+                            std::atomic<std::uint64_t>& total) {
+        if (auto const value = total.exchange(0); value != 0)
+            counter.increment(value);
+    };
+
+    publish(stats_.fetches, fetches_);
+    publish(stats_.fetchHits, fetchHits_);
+    publish(stats_.fetchTime, fetchMillis_);
+    publish(stats_.writes, writes_);
+    publish(stats_.writeTime, writeMillis_);
+}
+
 void
 NodeStoreScheduler::scheduleTask(NodeStore::Task& task)
 {
@@ -44,6 +64,11 @@ NodeStoreScheduler::scheduleTask(NodeStore::Task& task)
 void
 NodeStoreScheduler::onFetch(NodeStore::FetchReport const& report)
 {
+    fetches_.fetch_add(1, std::memory_order_relaxed);
+    if (report.wasFound)
+        fetchHits_.fetch_add(1, std::memory_order_relaxed);
+    fetchMillis_.fetch_add(report.elapsed.count(), std::memory_order_relaxed);
+
     if (jobQueue_.isStopped())
         return;
 
@@ -57,6 +82,9 @@ NodeStoreScheduler::onFetch(NodeStore::FetchReport const& report)
 void
 NodeStoreScheduler::onBatchWrite(NodeStore::BatchWriteReport const& report)
 {
+    writes_.fetch_add(report.writeCount, std::memory_order_relaxed);
+    writeMillis_.fetch_add(report.elapsed.count(), std::memory_order_relaxed);
+
     if (jobQueue_.isStopped())
         return;
 
@@ -23,13 +23,28 @@
 #include <xrpld/core/JobQueue.h>
 #include <xrpld/nodestore/Scheduler.h>
 
+#include <xrpl/beast/insight/Collector.h>
+#include <xrpl/beast/insight/Counter.h>
+#include <xrpl/beast/insight/Hook.h>
+
+#include <atomic>
+#include <cstdint>
+
 namespace ripple {
 
-/** A NodeStore::Scheduler which uses the JobQueue. */
+/** A NodeStore::Scheduler which uses the JobQueue.
+
+    The fetches and writes it is told about, and the milliseconds they
+    took, are also counted in insight. They are totalled here and published
+    from a hook, since a report can come for every fetch. A mean duration
+    is the rate of the time counter over the rate of the count.
+*/
 class NodeStoreScheduler : public NodeStore::Scheduler
 {
 public:
-    explicit NodeStoreScheduler(JobQueue& jobQueue);
+    NodeStoreScheduler(
+        JobQueue& jobQueue,
+        beast::insight::Collector::ptr const& collector);
 
     void
     scheduleTask(NodeStore::Task& task) override;
@@ -39,7 +54,43 @@ public:
     onBatchWrite(NodeStore::BatchWriteReport const& report) override;
 
 private:
+    void
+    collectMetrics();
+
     JobQueue& jobQueue_;
+
+    // Totals since the hook last ran
+    std::atomic<std::uint64_t> fetches_{0};
+    std::atomic<std::uint64_t> fetchHits_{0};
+    std::atomic<std::uint64_t> fetchMillis_{0};
+    std::atomic<std::uint64_t> writes_{0};
+    std::atomic<std::uint64_t> writeMillis_{0};
+
+    struct Stats
+    {
+        template <class Handler>
+        Stats(
+            Handler const& handler,
+            beast::insight::Collector::ptr const& collector)
+            : hook(collector->make_hook(handler))
+            , fetches(collector->make_counter("nodestore", "fetches"))
+            , fetchHits(collector->make_counter("nodestore", "fetch_hits"))
+            , fetchTime(collector->make_counter("nodestore", "fetch_time_ms"))
+            , writes(collector->make_counter("nodestore", "writes"))
+            , writeTime(collector->make_counter("nodestore", "write_time_ms"))
+        {
+        }
+
+        beast::insight::Hook hook;
+        beast::insight::Counter fetches;
+        beast::insight::Counter fetchHits;
+        beast::insight::Counter fetchTime;
+        beast::insight::Counter writes;
+        beast::insight::Counter writeTime;
+    };
+
+    // Declared last, so the hook is removed before anything it reads
+    Stats stats_;
 };
 
 }  // namespace ripple
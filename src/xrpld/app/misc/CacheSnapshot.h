@@ -0,0 +1,88 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#ifndef RIPPLE_APP_MISC_CACHESNAPSHOT_H_INCLUDED
+#define RIPPLE_APP_MISC_CACHESNAPSHOT_H_INCLUDED
+
+#include <xrpld/app/rdb/Wallet.h>
+
+#include <xrpl/beast/utility/Journal.h>
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
+namespace ripple {
+
+class Application;
+
+/** Saves and restores the keys of the hottest cache entries.
+
+    A restarted server starts with cold caches and pays for it with node
+    store reads on the critical path while it syncs. To avoid that, the keys
+    of the most recent validated ledgers and of the inner nodes nearest the
+    root of the validated state map are saved to the wallet database
+    periodically and at shutdown. On startup the objects are read back from
+    the node store in bulk on a low priority job.
+
+    Only keys are saved: the node store remains the source of the data.
+    FullBelow markers are not saved, since finding a node again does not
+    show that its subtree is still complete.
+*/
+class CacheSnapshot
+{
+public:
+    /** Create the snapshot manager.
+
+        @param app The application.
+        @param limit The most inner node keys to save, or zero to disable
+                     the snapshot.
+        @param j Journal.
+    */
+    CacheSnapshot(Application& app, std::size_t limit, beast::Journal j);
+
+    /** Start warming the caches from the saved snapshot, if any. */
+    void
+    load();
+
+    /** Save the snapshot if it has not been saved recently. */
+    void
+    onSweep();
+
+    /** Save the snapshot. */
+    void
+    save();
+
+private:
+    void
+    warm(CacheSnapshotKeys const& keys);
+
+    Application& app_;
+    std::size_t const limit_;
+    beast::Journal const j_;
+
+    // Guards lastSave_, and keeps the periodic save and the one at shutdown
+    // from overlapping.
+    std::mutex mutex_;
+    std::chrono::steady_clock::time_point lastSave_;
+};
+
+}  // namespace ripple
+
+#endif
@@ -2251,12 +2251,13 @@ NetworkOPsImp::pubManifest(Manifest const& mo)
             jvObj[jss::domain] = mo.domain;
         jvObj[jss::manifest] = strHex(mo.serialized);
 
+        auto const msg = std::make_shared<InfoSubMessage const>(jvObj);
         for (auto i = mStreamMaps[sManifests].begin();
              i != mStreamMaps[sManifests].end();)
         {
             if (auto p = i->second.lock())
             {
-                p->send(jvObj, true);
+                p->send(msg, true);
                 ++i;
             }
             else
@@ -2354,6 +2355,7 @@ NetworkOPsImp::pubServer()
 
         mLastFeeSummary = f;
 
+        auto const msg = std::make_shared<InfoSubMessage const>(jvObj);
         for (auto i = mStreamMaps[sServer].begin();
              i != mStreamMaps[sServer].end();)
         {
@@ -2364,7 +2366,7 @@ NetworkOPsImp::pubServer()
             //             sending of JSON data.
             if (p)
             {
-                p->send(jvObj, true);
+                p->send(msg, true);
                 ++i;
             }
             else
@@ -2387,11 +2389,12 @@ NetworkOPsImp::pubConsensus(ConsensusPhase phase)
         jvObj[jss::type] = "consensusPhase";
         jvObj[jss::consensus] = to_string(phase);
 
+        auto const msg = std::make_shared<InfoSubMessage const>(jvObj);
         for (auto i = streamMap.begin(); i != streamMap.end();)
         {
             if (auto p = i->second.lock())
             {
-                p->send(jvObj, true);
+                p->send(msg, true);
                 ++i;
             }
             else
@@ -2495,14 +2498,13 @@ NetworkOPsImp::pubValidation(std::shared_ptr<STValidation> const& val)
                 }
             });
 
+        MultiApiMessage const msg{std::move(multiObj)};
         for (auto i = mStreamMaps[sValidations].begin();
              i != mStreamMaps[sValidations].end();)
         {
             if (auto p = i->second.lock())
             {
-                multiObj.visit(
-                    p->getApiVersion(),  //
-                    [&](Json::Value const& jv) { p->send(jv, true); });
+                msg.send(*p, true);
                 ++i;
             }
             else
@@ -2524,6 +2526,7 @@ NetworkOPsImp::pubPeerStatus(std::function<Json::Value(void)> const& func)
 
         jvObj[jss::type] = "peerStatusChange";
 
+        auto const msg = std::make_shared<InfoSubMessage const>(jvObj);
         for (auto i = mStreamMaps[sPeerStatus].begin();
              i != mStreamMaps[sPeerStatus].end();)
         {
@@ -2531,7 +2534,7 @@ NetworkOPsImp::pubPeerStatus(std::function<Json::Value(void)> const& func)
 
             if (p)
             {
-                p->send(jvObj, true);
+                p->send(msg, true);
                 ++i;
             }
             else
@@ -2801,6 +2804,13 @@ NetworkOPsImp::getServerInfo(bool human, bool admin, bool counters)
         app_.getNodeStore().getCountsJson(nodestore);
         info[jss::counters][jss::nodestore] = nodestore;
         info[jss::current_activities] = app_.getPerfLog().currentJson();
+
+        if (admin)
+        {
+            if (auto profile = app_.getPerfLog().profileJson();
+                !profile.isNull())
+                info[jss::profile] = std::move(profile);
+        }
     }
 
     info[jss::pubkey_node] =
@@ -3066,8 +3076,8 @@ NetworkOPsImp::pubProposedTransaction(
     if (transaction->isFlag(tfInnerBatchTxn))
         return;
 
-    MultiApiJson jvObj =
-        transJson(transaction, result, false, ledger, std::nullopt);
+    MultiApiMessage const msg{
+        transJson(transaction, result, false, ledger, std::nullopt)};
 
     {
         std::lock_guard sl(mSubLock);
@@ -3079,9 +3089,7 @@ NetworkOPsImp::pubProposedTransaction(
 
             if (p)
             {
-                jvObj.visit(
-                    p->getApiVersion(),  //
-                    [&](Json::Value const& jv) { p->send(jv, true); });
+                msg.send(*p, true);
                 ++it;
             }
             else
@@ -3148,13 +3156,14 @@ NetworkOPsImp::pubLedger(std::shared_ptr<ReadView const> const& lpAccepted)
                     app_.getLedgerMaster().getCompleteLedgers();
             }
 
+            auto const msg = std::make_shared<InfoSubMessage const>(jvObj);
             auto it = mStreamMaps[sLedger].begin();
             while (it != mStreamMaps[sLedger].end())
             {
                 InfoSub::pointer p = it->second.lock();
                 if (p)
                 {
-                    p->send(jvObj, true);
+                    p->send(msg, true);
                     ++it;
                 }
                 else
@@ -3164,7 +3173,8 @@ NetworkOPsImp::pubLedger(std::shared_ptr<ReadView const> const& lpAccepted)
 
         if (!mStreamMaps[sBookChanges].empty())
         {
-            Json::Value jvObj = ripple::RPC::computeBookChanges(lpAccepted);
+            auto const msg = std::make_shared<InfoSubMessage const>(
+                ripple::RPC::computeBookChanges(lpAccepted));
 
             auto it = mStreamMaps[sBookChanges].begin();
             while (it != mStreamMaps[sBookChanges].end())
@@ -3172,7 +3182,7 @@ NetworkOPsImp::pubLedger(std::shared_ptr<ReadView const> const& lpAccepted)
                 InfoSub::pointer p = it->second.lock();
                 if (p)
                 {
-                    p->send(jvObj, true);
+                    p->send(msg, true);
                     ++it;
                 }
                 else
@@ -3372,7 +3382,8 @@ NetworkOPsImp::pubValidatedTransaction(
     // Create two different Json objects, for different API versions
     auto const metaRef = std::ref(transaction.getMeta());
     auto const trResult = transaction.getResult();
-    MultiApiJson jvObj = transJson(stTxn, trResult, true, ledger, metaRef);
+    MultiApiMessage const msg{
+        transJson(stTxn, trResult, true, ledger, metaRef)};
 
     {
         std::lock_guard sl(mSubLock);
@@ -3384,9 +3395,7 @@ NetworkOPsImp::pubValidatedTransaction(
 
             if (p)
             {
-                jvObj.visit(
-                    p->getApiVersion(),  //
-                    [&](Json::Value const& jv) { p->send(jv, true); });
+                msg.send(*p, true);
                 ++it;
             }
             else
@@ -3401,9 +3410,7 @@ NetworkOPsImp::pubValidatedTransaction(
 
             if (p)
             {
-                jvObj.visit(
-                    p->getApiVersion(),  //
-                    [&](Json::Value const& jv) { p->send(jv, true); });
+                msg.send(*p, true);
                 ++it;
             }
             else
@@ -3412,7 +3419,7 @@ NetworkOPsImp::pubValidatedTransaction(
     }
 
     if (transaction.getResult() == tesSUCCESS)
-        app_.getOrderBookDB().processTxn(ledger, transaction, jvObj);
+        app_.getOrderBookDB().processTxn(ledger, transaction, msg);
 
     pubAccountTransaction(ledger, transaction, last);
 }
@@ -3521,11 +3528,13 @@ NetworkOPsImp::pubAccountTransaction(
         auto const trResult = transaction.getResult();
         MultiApiJson jvObj = transJson(stTxn, trResult, true, ledger, metaRef);
 
-        for (InfoSub::ref isrListener : notify)
+        if (!notify.empty())
         {
-            jvObj.visit(
-                isrListener->getApiVersion(),  //
-                [&](Json::Value const& jv) { isrListener->send(jv, true); });
+            // The account history streams still need the object
+            MultiApiMessage const msg{
+                accountHistoryNotify.empty() ? std::move(jvObj) : jvObj};
+            for (InfoSub::ref isrListener : notify)
+                msg.send(*isrListener, true);
         }
 
         if (last)
@@ -3603,10 +3612,14 @@ NetworkOPsImp::pubProposedAccountTransaction(
         // Create two different Json objects, for different API versions
         MultiApiJson jvObj = transJson(tx, result, false, ledger, std::nullopt);
 
-        for (InfoSub::ref isrListener : notify)
-            jvObj.visit(
-                isrListener->getApiVersion(),  //
-                [&](Json::Value const& jv) { isrListener->send(jv, true); });
+        if (!notify.empty())
+        {
+            // The account history streams still need the object
+            MultiApiMessage const msg{
+                accountHistoryNotify.empty() ? std::move(jvObj) : jvObj};
+            for (InfoSub::ref isrListener : notify)
+                msg.send(*isrListener, true);
+        }
 
         XRPL_ASSERT(
             jvObj.isMember(jss::account_history_tx_stream) ==
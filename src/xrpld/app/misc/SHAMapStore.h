@@ -66,7 +66,8 @@ public:
     advisoryDelete() const = 0;
 
     /** Maximum ledger that has been deleted, or will be deleted if
-     *  currently in the act of online deletion.
+     *  currently in the act of online deletion. Zero if online deletion
+     *  is not enabled.
      */
     virtual LedgerIndex
     getLastRotated() = 0;
@@ -152,6 +152,9 @@ public:
     LedgerIndex
     getLastRotated() override
     {
+        // Without online delete there is no state database to consult
+        if (!deleteInterval_)
+            return 0;
         return state_db_.getState().lastRotated;
     }
 
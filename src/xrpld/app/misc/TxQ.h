@@ -22,6 +22,9 @@
 
 #include <xrpld/app/tx/applySteps.h>
 
+#include <xrpl/beast/insight/Collector.h>
+#include <xrpl/beast/insight/Gauge.h>
+#include <xrpl/beast/insight/Hook.h>
 #include <xrpl/ledger/ApplyView.h>
 #include <xrpl/ledger/OpenView.h>
 #include <xrpl/protocol/RippleLedgerHash.h>
@@ -256,7 +259,9 @@ public:
     };
 
     /// Constructor
-    TxQ(Setup const& setup, beast::Journal j);
+    TxQ(Setup const& setup,
+        beast::insight::Collector::ptr const& collector,
+        beast::Journal j);
 
     /// Destructor
     virtual ~TxQ();
@@ -798,7 +803,36 @@ private:
     */
     std::mutex mutable mutex_;
 
+    struct Stats
+    {
+        template <class Handler>
+        Stats(
+            Handler const& handler,
+            beast::insight::Collector::ptr const& collector)
+            : hook(collector->make_hook(handler))
+            , count(collector->make_gauge("txq", "count"))
+            , maxSize(collector->make_gauge("txq", "max_size"))
+            , expectedLedgerSize(
+                  collector->make_gauge("txq", "expected_ledger_size"))
+            , escalationMultiplier(
+                  collector->make_gauge("txq", "escalation_multiplier"))
+        {
+        }
+
+        beast::insight::Hook hook;
+        beast::insight::Gauge count;
+        beast::insight::Gauge maxSize;
+        beast::insight::Gauge expectedLedgerSize;
+        beast::insight::Gauge escalationMultiplier;
+    };
+
+    // Declared last, so the hook is removed before anything it reads
+    Stats stats_;
+
 private:
+    void
+    collectMetrics();
+
     /// Is the queue at least `fillPercentage` full?
     template <size_t fillPercentage = 100>
     bool
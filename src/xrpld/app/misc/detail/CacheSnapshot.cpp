@@ -0,0 +1,223 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpld/app/ledger/LedgerMaster.h>
+#include <xrpld/app/main/Application.h>
+#include <xrpld/app/misc/CacheSnapshot.h>
+#include <xrpld/app/misc/SHAMapStore.h>
+#include <xrpld/core/JobQueue.h>
+#include <xrpld/nodestore/Database.h>
+#include <xrpld/shamap/Family.h>
+#include <xrpld/shamap/SHAMapTreeNode.h>
+
+#include <algorithm>
+
+namespace ripple {
+
+namespace {
+
+// How often the snapshot is refreshed while the server runs
+constexpr std::chrono::hours saveInterval{1};
+
+// How many of the most recent validated ledgers to reload
+constexpr std::uint32_t ledgerCount = 8;
+
+// How many objects to read from the node store at once
+constexpr std::size_t batchSize = 256;
+
+}  // namespace
+
+CacheSnapshot::CacheSnapshot(
+    Application& app,
+    std::size_t limit,
+    beast::Journal j)
+    : app_(app)
+    , limit_(limit)
+    , j_(j)
+    , lastSave_(std::chrono::steady_clock::now())
+{
+}
+
+void
+CacheSnapshot::load()
+{
+    if (limit_ == 0)
+        return;
+
+    std::optional<CacheSnapshotKeys> keys;
+    try
+    {
+        keys = loadCacheSnapshot(*app_.getWalletDB().checkoutDb());
+    }
+    catch (std::exception const& e)
+    {
+        JLOG(j_.warn()) << "Unable to read the cache snapshot: " << e.what();
+        return;
+    }
+
+    if (!keys)
+        return;
+
+    // Online delete may have removed the objects
+    if (keys->lastRotated != app_.getSHAMapStore().getLastRotated())
+    {
+        JLOG(j_.info()) << "Ignoring the cache snapshot: the node store has "
+                           "rotated since it was saved";
+        return;
+    }
+
+    app_.getJobQueue().addJob(
+        jtCACHE_WARM, "CacheSnapshot::warm", [this, keys = std::move(*keys)]() {
+            warm(keys);
+        });
+}
+
+void
+CacheSnapshot::onSweep()
+{
+    if (limit_ == 0)
+        return;
+
+    {
+        std::lock_guard lock(mutex_);
+        if (std::chrono::steady_clock::now() - lastSave_ < saveInterval)
+            return;
+    }
+
+    save();
+}
+
+void
+CacheSnapshot::save()
+{
+    if (limit_ == 0)
+        return;
+
+    std::lock_guard lock(mutex_);
+    lastSave_ = std::chrono::steady_clock::now();
+
+    auto& ledgerMaster = app_.getLedgerMaster();
+    auto const ledger = ledgerMaster.getValidatedLedger();
+    if (!ledger)
+        return;
+
+    CacheSnapshotKeys keys;
+    keys.lastRotated = app_.getSHAMapStore().getLastRotated();
+
+    keys.ledgers.push_back(ledger->info().hash);
+    for (std::uint32_t i = 1; i < ledgerCount && i < ledger->info().seq; ++i)
+    {
+        auto const hash = ledgerMaster.getHashBySeq(ledger->info().seq - i);
+        if (hash.isZero())
+            break;
+        keys.ledgers.push_back(hash);
+    }
+
+    auto const innerNodes = ledger->stateMap().getTopInnerHashes(limit_);
+    keys.innerNodes.reserve(innerNodes.size());
+    for (auto const& hash : innerNodes)
+        keys.innerNodes.push_back(hash.as_uint256());
+
+    try
+    {
+        saveCacheSnapshot(*app_.getWalletDB().checkoutDb(), keys);
+    }
+    catch (std::exception const& e)
+    {
+        JLOG(j_.warn()) << "Unable to save the cache snapshot: " << e.what();
+        return;
+    }
+
+    JLOG(j_.debug()) << "Saved cache snapshot: " << keys.ledgers.size()
+                     << " ledgers, " << keys.innerNodes.size()
+                     << " inner nodes";
+}
+
+void
+CacheSnapshot::warm(CacheSnapshotKeys const& keys)
+{
+    using namespace std::chrono;
+    auto const start = steady_clock::now();
+
+    auto const treeNodeCache = app_.getNodeFamily().getTreeNodeCache();
+
+    // Read the objects in batches, so the backend can service each batch
+    // with a single request, and give up early if the server is stopping.
+    auto fetch = [this](std::vector<uint256> const& hashes, auto&& onFetch) {
+        std::size_t found = 0;
+        std::vector<uint256> batch;
+        batch.reserve(batchSize);
+        for (auto it = hashes.begin(); it != hashes.end();)
+        {
+            if (app_.isStopping())
+                break;
+
+            auto const end =
+                it + std::min<std::size_t>(batchSize, hashes.end() - it);
+            batch.assign(it, end);
+            it = end;
+
+            auto const objects = app_.getNodeStore().fetchBatch(batch);
+            for (std::size_t i = 0; i < objects.size(); ++i)
+            {
+                if (objects[i] && onFetch(batch[i], *objects[i]))
+                    ++found;
+            }
+        }
+        return found;
+    };
+
+    auto const innerNodes = fetch(
+        keys.innerNodes, [&](uint256 const& hash, NodeObject const& object) {
+            try
+            {
+                auto node = SHAMapTreeNode::makeFromPrefix(
+                    makeSlice(object.getData()), SHAMapHash{hash});
+                if (!node)
+                    return false;
+                treeNodeCache->canonicalize_replace_client(hash, node);
+                return true;
+            }
+            catch (std::exception const& e)
+            {
+                JLOG(j_.warn()) << "Invalid node in cache snapshot "
+                                << to_string(hash) << ": " << e.what();
+                return false;
+            }
+        });
+
+    // Oldest first, so each ledger finds its parent already loaded
+    std::size_t ledgers = 0;
+    for (auto it = keys.ledgers.rbegin(); it != keys.ledgers.rend(); ++it)
+    {
+        if (app_.isStopping())
+            break;
+        if (app_.getLedgerMaster().getLedgerByHash(*it))
+            ++ledgers;
+    }
+
+    JLOG(j_.info()) << "Warmed caches from snapshot in "
+                    << duration_cast<milliseconds>(steady_clock::now() - start)
+                           .count()
+                    << "ms: " << ledgers << " of " << keys.ledgers.size()
+                    << " ledgers, " << innerNodes << " of "
+                    << keys.innerNodes.size() << " inner nodes";
+}
+
+}  // namespace ripple
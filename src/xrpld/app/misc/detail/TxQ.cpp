@@ -28,6 +28,7 @@
 #include <xrpl/protocol/st.h>
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <numeric>
 
@@ -361,16 +362,38 @@ TxQ::TxQAccount::remove(SeqProxy seqProx)
 
 //////////////////////////////////////////////////////////////////////////
 
-TxQ::TxQ(Setup const& setup, beast::Journal j)
-    : setup_(setup), j_(j), feeMetrics_(setup, j), maxSize_(std::nullopt)
+TxQ::TxQ(
+    Setup const& setup,
+    beast::insight::Collector::ptr const& collector,
+    beast::Journal j)
+    : setup_(setup)
+    , j_(j)
+    , feeMetrics_(setup, j)
+    , maxSize_(std::nullopt)
+    , stats_(std::bind(&TxQ::collectMetrics, this), collector)
 {
 }
 
 TxQ::~TxQ()
 {
+    // The hook may still run until stats_ is destroyed
+    std::lock_guard lock(mutex_);
     byFee_.clear();
 }
 
+void
+TxQ::collectMetrics()
+{
+    std::lock_guard lock(mutex_);
+
+    auto const snapshot = feeMetrics_.getSnapshot();
+
+    stats_.count = byFee_.size();
+    stats_.maxSize = maxSize_.value_or(0);
+    stats_.expectedLedgerSize = snapshot.txnsExpected;
+    stats_.escalationMultiplier = snapshot.escalationMultiplier.value();
+}
+
 template <size_t fillPercentage>
 bool
 TxQ::isFull() const
@@ -25,6 +25,11 @@
 #include <xrpld/core/DatabaseCon.h>
 #include <xrpld/overlay/PeerReservationTable.h>
 
+#include <xrpl/protocol/Protocol.h>
+
+#include <optional>
+#include <vector>
+
 namespace ripple {
 
 /**
@@ -145,6 +150,35 @@ deletePeerReservation(soci::session& session, PublicKey const& nodeId);
 bool
 createFeatureVotes(soci::session& session);
 
+/** Keys of the cache entries saved to warm the caches on restart. */
+struct CacheSnapshotKeys
+{
+    /** The online delete rotation the keys were saved under. */
+    LedgerIndex lastRotated = 0;
+
+    /** Hashes of the most recent validated ledgers, newest first. */
+    std::vector<uint256> ledgers;
+
+    /** Hashes of the inner nodes nearest the root of the state map. */
+    std::vector<uint256> innerNodes;
+};
+
+/**
+ * @brief saveCacheSnapshot Replaces the saved cache snapshot.
+ * @param session Session with the wallet database.
+ * @param keys Keys of the cache entries to save.
+ */
+void
+saveCacheSnapshot(soci::session& session, CacheSnapshotKeys const& keys);
+
+/**
+ * @brief loadCacheSnapshot Reads the saved cache snapshot.
+ * @param session Session with the wallet database.
+ * @return The saved keys, or an empty optional if there are none.
+ */
+std::optional<CacheSnapshotKeys>
+loadCacheSnapshot(soci::session& session);
+
 // For historical reasons the up-vote and down-vote integer representations
 // are unintuitive.
 enum class AmendmentVote : int { obsolete = -1, up = 0, down = 1 };
@@ -66,6 +66,75 @@ to_string(TableType type)
     }
 }
 
+/**
+ * @brief BatchStatement Accumulates comma separated terms of a single
+ *        statement, such as the rows of a multi-row INSERT or the values of an
+ *        IN list, and executes it whenever it grows large enough, so that a
+ *        ledger's transactions are written with a handful of statements
+ *        rather than several per transaction.
+ */
+class BatchStatement
+{
+public:
+    BatchStatement(
+        soci::session& session,
+        std::string prefix,
+        std::string suffix = ";")
+        : session_(session)
+        , prefix_(std::move(prefix))
+        , suffix_(std::move(suffix))
+    {
+    }
+
+    BatchStatement(BatchStatement const&) = delete;
+    BatchStatement&
+    operator=(BatchStatement const&) = delete;
+
+    /**
+     * @brief add Appends a term, executing the statement first if it is
+     *        already full.
+     * @param term Text of the term, e.g. "('a', 1)".
+     */
+    void
+    add(std::string const& term)
+    {
+        if (terms_ >= maxTerms || sql_.size() >= maxLength)
+            flush();
+
+        if (terms_++ == 0)
+            sql_ = prefix_;
+        else
+            sql_ += ',';
+
+        sql_ += term;
+    }
+
+    /**
+     * @brief flush Executes the accumulated statement, if any.
+     */
+    void
+    flush()
+    {
+        if (terms_ == 0)
+            return;
+
+        sql_ += suffix_;
+        session_ << sql_;
+        terms_ = 0;
+    }
+
+private:
+    // Keep any one statement to a size SQLite parses comfortably.
+    static constexpr std::size_t maxTerms = 500;
+    static constexpr std::size_t maxLength = 4 * 1024 * 1024;
+
+    soci::session& session_;
+    std::string const prefix_;
+    std::string const suffix_;
+    std::string sql_;
+    std::size_t terms_ = 0;
+};
+
 DatabasePairValid
 makeLedgerDBs(
     Config const& config,
@@ -263,8 +332,6 @@ saveValidatedLedger(
             "DELETE FROM Transactions WHERE LedgerSeq = %u;");
         static boost::format deleteTrans2(
             "DELETE FROM AccountTransactions WHERE LedgerSeq = %u;");
-        static boost::format deleteAcctTrans(
-            "DELETE FROM AccountTransactions WHERE TransID = '%s';");
 
         {
             auto db = ldgDB.checkoutDb();
@@ -280,6 +347,26 @@ saveValidatedLedger(
             *db << boost::str(deleteTrans1 % seq);
             *db << boost::str(deleteTrans2 % seq);
 
+            static std::string const deleteAcctTrans(
+                "DELETE FROM AccountTransactions WHERE TransID IN (");
+            static std::string const insertAcctTrans(
+                "INSERT INTO AccountTransactions "
+                "(TransID, Account, LedgerSeq, TxnSeq) VALUES ");
+
+            // Stale rows for these transactions must be gone before any new
+            // ones are written.
+            {
+                BatchStatement deletes(*db, deleteAcctTrans, ");");
+                for (auto const& acceptedLedgerTx : *aLedger)
+                    deletes.add(
+                        "'" + to_string(acceptedLedgerTx->getTransactionID()) +
+                        "'");
+                deletes.flush();
+            }
+
+            BatchStatement accountRows(*db, insertAcctTrans);
+            BatchStatement txRows(*db, STTx::getMetaSQLInsertReplaceHeader());
+
             std::string const ledgerSeq(std::to_string(seq));
 
             for (auto const& acceptedLedgerTx : *aLedger)
@@ -290,44 +377,29 @@ saveValidatedLedger(
                 std::string const txnSeq(
                     std::to_string(acceptedLedgerTx->getTxnSeq()));
 
-                *db << boost::str(deleteAcctTrans % transactionID);
-
                 auto const& accts = acceptedLedgerTx->getAffected();
 
                 if (!accts.empty())
                 {
-                    std::string sql(
-                        "INSERT INTO AccountTransactions "
-                        "(TransID, Account, LedgerSeq, TxnSeq) VALUES ");
+                    // In argument order we have: 64 + 34 + 10 + 10 = 118
+                    // + 10 extra = 128 bytes
+                    std::string row;
+                    row.reserve(128);
 
-                    // Try to make an educated guess on how much space we'll
-                    // need for our arguments. In argument order we have: 64
-                    // + 34 + 10 + 10 = 118 + 10 extra = 128 bytes
-                    sql.reserve(sql.length() + (accts.size() * 128));
-
-                    bool first = true;
                     for (auto const& account : accts)
                     {
-                        if (!first)
-                            sql += ", ('";
-                        else
-                        {
-                            sql += "('";
-                            first = false;
-                        }
-
-                        sql += txnId;
-                        sql += "','";
-                        sql += toBase58(account);
-                        sql += "',";
-                        sql += ledgerSeq;
-                        sql += ",";
-                        sql += txnSeq;
-                        sql += ")";
+                        row = "('";
+                        row += txnId;
+                        row += "','";
+                        row += toBase58(account);
+                        row += "',";
+                        row += ledgerSeq;
+                        row += ",";
+                        row += txnSeq;
+                        row += ")";
+                        JLOG(j.trace()) << "ActTx: " << row;
+                        accountRows.add(row);
                     }
-                    sql += ";";
-                    JLOG(j.trace()) << "ActTx: " << sql;
-                    *db << sql;
                 }
                 else if (auto const& sleTxn = acceptedLedgerTx->getTxn();
                          !isPseudoTx(*sleTxn))
@@ -339,11 +411,8 @@ saveValidatedLedger(
                     JLOG(j.warn()) << sleTxn->getJson(JsonOptions::none);
                 }
 
-                *db
-                    << (STTx::getMetaSQLInsertReplaceHeader() +
-                        acceptedLedgerTx->getTxn()->getMetaSQL(
-                            seq, acceptedLedgerTx->getEscMeta()) +
-                        ";");
+                txRows.add(acceptedLedgerTx->getTxn()->getMetaSQL(
+                    seq, acceptedLedgerTx->getEscMeta()));
 
                 app.getMasterTransaction().inLedger(
                     transactionID,
@@ -352,6 +421,9 @@ saveValidatedLedger(
                     app.config().NETWORK_ID);
             }
 
+            accountRows.flush();
+            txRows.flush();
+
             tr.commit();
         }
 
@@ -1053,62 +1125,60 @@ accountTxPage(
 
     std::optional<RelationalDatabase::AccountTxMarker> newmarker;
 
-    static std::string const prefix(
-        R"(SELECT AccountTransactions.LedgerSeq,AccountTransactions.TxnSeq,
-          Status,RawTxn,TxnMeta
-          FROM AccountTransactions INNER JOIN Transactions
-          ON Transactions.TransID = AccountTransactions.TransID
-          AND AccountTransactions.Account = '%s' WHERE
-          )");
-
-    std::string sql;
+    // A single statement serves both the first page and pages resuming
+    // from a marker, with every value bound rather than formatted into the
+    // text. Rows of the marker's ledger are filtered by TxnSeq while the
+    // range itself is a plain LedgerSeq interval: that keeps the whole
+    // query an ordered range scan of AcctTxIndex (Account, LedgerSeq,
+    // TxnSeq, TransID) which stops once LIMIT rows have been joined,
+    // instead of a UNION whose halves SQLite has to merge and sort.
+    static std::string const sqlForward = R"sql(
+        SELECT AccountTransactions.LedgerSeq,AccountTransactions.TxnSeq,
+        Status,RawTxn,TxnMeta
+        FROM AccountTransactions INNER JOIN Transactions
+        ON Transactions.TransID = AccountTransactions.TransID
+        WHERE AccountTransactions.Account = :account AND
+        AccountTransactions.LedgerSeq BETWEEN :minLedger AND :maxLedger AND
+        (AccountTransactions.LedgerSeq <> :findLedger OR
+        AccountTransactions.TxnSeq >= :findSeq)
+        ORDER BY AccountTransactions.LedgerSeq ASC,
+        AccountTransactions.TxnSeq ASC
+        LIMIT :limit;)sql";
+
+    static std::string const sqlBackward = R"sql(
+        SELECT AccountTransactions.LedgerSeq,AccountTransactions.TxnSeq,
+        Status,RawTxn,TxnMeta
+        FROM AccountTransactions INNER JOIN Transactions
+        ON Transactions.TransID = AccountTransactions.TransID
+        WHERE AccountTransactions.Account = :account AND
+        AccountTransactions.LedgerSeq BETWEEN :minLedger AND :maxLedger AND
+        (AccountTransactions.LedgerSeq <> :findLedger OR
+        AccountTransactions.TxnSeq <= :findSeq)
+        ORDER BY AccountTransactions.LedgerSeq DESC,
+        AccountTransactions.TxnSeq DESC
+        LIMIT :limit;)sql";
 
     // SQL's BETWEEN uses a closed interval ([a,b])
+    std::uint32_t minLedger = options.minLedger;
+    std::uint32_t maxLedger = options.maxLedger;
 
-    char const* const order = forward ? "ASC" : "DESC";
-
-    if (findLedger == 0)
+    // A marker replaces the bound it resumes from. The marker's own ledger
+    // stays in range even if the requested range no longer covers it.
+    if (findLedger != 0)
     {
-        sql = boost::str(
-            boost::format(
-                prefix + (R"(AccountTransactions.LedgerSeq BETWEEN %u AND %u
-             ORDER BY AccountTransactions.LedgerSeq %s,
-             AccountTransactions.TxnSeq %s
-             LIMIT %u;)")) %
-            toBase58(options.account) % options.minLedger % options.maxLedger %
-            order % order % queryLimit);
+        if (forward)
+        {
+            minLedger = findLedger;
+            maxLedger = std::max(maxLedger, findLedger);
+        }
+        else
+        {
+            minLedger = std::min(minLedger, findLedger);
+            maxLedger = findLedger;
+        }
     }
-    else
-    {
-        char const* const compare = forward ? ">=" : "<=";
-        std::uint32_t const minLedger =
-            forward ? findLedger + 1 : options.minLedger;
-        std::uint32_t const maxLedger =
-            forward ? options.maxLedger : findLedger - 1;
 
-        auto b58acct = toBase58(options.account);
-        sql = boost::str(
-            boost::format((
-                R"(SELECT AccountTransactions.LedgerSeq,AccountTransactions.TxnSeq,
-            Status,RawTxn,TxnMeta
-            FROM AccountTransactions, Transactions WHERE
-            (AccountTransactions.TransID = Transactions.TransID AND
-            AccountTransactions.Account = '%s' AND
-            AccountTransactions.LedgerSeq BETWEEN %u AND %u)
-            UNION
-            SELECT AccountTransactions.LedgerSeq,AccountTransactions.TxnSeq,Status,RawTxn,TxnMeta
-            FROM AccountTransactions, Transactions WHERE
-            (AccountTransactions.TransID = Transactions.TransID AND
-            AccountTransactions.Account = '%s' AND
-            AccountTransactions.LedgerSeq = %u AND
-            AccountTransactions.TxnSeq %s %u)
-            ORDER BY AccountTransactions.LedgerSeq %s,
-            AccountTransactions.TxnSeq %s
-            LIMIT %u;
-            )")) %
-            b58acct % minLedger % maxLedger % b58acct % findLedger % compare %
-            findSeq % order % order % queryLimit);
-    }
+    auto const account = toBase58(options.account);
 
     {
         Blob rawData;
@@ -1123,12 +1193,18 @@ accountTxPage(
         soci::indicator dataPresent, metaPresent;
 
         soci::statement st =
-            (session.prepare << sql,
+            (session.prepare << (forward ? sqlForward : sqlBackward),
              soci::into(ledgerSeq),
              soci::into(txnSeq),
              soci::into(status),
              soci::into(txnData, dataPresent),
-             soci::into(txnMeta, metaPresent));
+             soci::into(txnMeta, metaPresent),
+             soci::use(account),
+             soci::use(minLedger),
+             soci::use(maxLedger),
+             soci::use(findLedger),
+             soci::use(findSeq),
+             soci::use(queryLimit));
 
         st.execute();
 
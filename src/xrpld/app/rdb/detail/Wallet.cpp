@@ -285,6 +285,68 @@ readAmendments(
     }
 }
 
+static void
+hashesToBlob(std::vector<uint256> const& hashes, soci::blob& to)
+{
+    std::vector<std::uint8_t> raw;
+    raw.reserve(hashes.size() * uint256::size());
+    for (auto const& hash : hashes)
+        raw.insert(raw.end(), hash.begin(), hash.end());
+    convert(raw, to);
+}
+
+static std::vector<uint256>
+hashesFromBlob(soci::blob& from)
+{
+    std::vector<std::uint8_t> raw;
+    convert(from, raw);
+
+    std::vector<uint256> hashes;
+    hashes.reserve(raw.size() / uint256::size());
+    for (std::size_t i = 0; i + uint256::size() <= raw.size();
+         i += uint256::size())
+        hashes.push_back(uint256::fromVoid(raw.data() + i));
+    return hashes;
+}
+
+void
+saveCacheSnapshot(soci::session& session, CacheSnapshotKeys const& keys)
+{
+    soci::blob ledgers(session);
+    soci::blob innerNodes(session);
+    hashesToBlob(keys.ledgers, ledgers);
+    hashesToBlob(keys.innerNodes, innerNodes);
+
+    soci::transaction tr(session);
+    session << "DELETE FROM CacheSnapshot;";
+    session << "INSERT INTO CacheSnapshot"
+               " (LastRotated, Ledgers, InnerNodes)"
+               " VALUES (:lastRotated, :ledgers, :innerNodes);",
+        soci::use(keys.lastRotated), soci::use(ledgers),
+        soci::use(innerNodes);
+    tr.commit();
+}
+
+std::optional<CacheSnapshotKeys>
+loadCacheSnapshot(soci::session& session)
+{
+    CacheSnapshotKeys keys;
+    soci::blob ledgers(session);
+    soci::blob innerNodes(session);
+
+    session << "SELECT LastRotated, Ledgers, InnerNodes"
+               " FROM CacheSnapshot;",
+        soci::into(keys.lastRotated), soci::into(ledgers),
+        soci::into(innerNodes);
+
+    if (!session.got_data())
+        return std::nullopt;
+
+    keys.ledgers = hashesFromBlob(ledgers);
+    keys.innerNodes = hashesFromBlob(innerNodes);
+    return keys;
+}
+
 void
 voteAmendment(
     soci::session& session,
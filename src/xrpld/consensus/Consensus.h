@@ -36,6 +36,8 @@
 #include <deque>
 #include <optional>
 #include <sstream>
+#include <utility>
+#include <vector>
 
 namespace ripple {
 
@@ -806,8 +808,11 @@ Consensus<Adaptor>::peerProposalInternal(
             JLOG(j_.info()) << "Peer " << peerID << " bows out";
             if (result_)
             {
-                for (auto& it : result_->disputes)
-                    it.second.unVote(peerID);
+                if (auto const slot = result_->disputePeers->find(peerID))
+                {
+                    for (auto& it : result_->disputes)
+                        it.second.unVote(*slot);
+                }
             }
             if (peerPosIt != currPeerPositions_.end())
                 currPeerPositions_.erase(peerID);
@@ -1377,6 +1382,7 @@ Consensus<Adaptor>::phaseEstablish(
     ConsensusParms const& parms = adaptor_.parms();
 
     result_->roundTime.tick(clock_.now());
+    result_->establishRounds = establishCounter_;
     result_->proposers = currPeerPositions_.size();
 
     convergePercent_ = result_->roundTime.read() * 100 /
@@ -1443,6 +1449,7 @@ Consensus<Adaptor>::closeLedger(std::unique_ptr<std::stringstream> const& clog)
     establishCounter_ = 0;
 
     result_.emplace(adaptor_.onClose(previousLedger_, now_, mode_.get()));
+    result_->openTime = openTime_.read();
     result_->roundTime.reset(clock_.now());
     // Share the newly created transaction set if we haven't already
     // received it from a peer
@@ -1515,8 +1522,11 @@ Consensus<Adaptor>::updateOurPositions(
                 // peer's proposal is stale, so remove it
                 NodeID_t const& peerID = peerProp.nodeID();
                 JLOG(j_.warn()) << "Removing stale proposal from " << peerID;
-                for (auto& dt : result_->disputes)
-                    dt.second.unVote(peerID);
+                if (auto const slot = result_->disputePeers->find(peerID))
+                {
+                    for (auto& dt : result_->disputes)
+                        dt.second.unVote(*slot);
+                }
                 it = currPeerPositions_.erase(it);
             }
             else
@@ -1845,6 +1855,18 @@ Consensus<Adaptor>::createDisputes(
 
     auto differences = result_->txns.compare(o);
 
+    // The sets the peers are proposing, looked up once rather than for
+    // every disputed transaction
+    std::vector<std::pair<std::size_t, TxSet_t const*>> peerSets;
+    peerSets.reserve(currPeerPositions_.size());
+    for (auto const& [nodeId, peerPos] : currPeerPositions_)
+    {
+        auto const cit = acquired_.find(peerPos.proposal().position());
+        if (cit != acquired_.end())
+            peerSets.emplace_back(
+                result_->disputePeers->slot(nodeId), &cit->second);
+    }
+
     int dc = 0;
 
     for (auto const& [txId, inThisSet] : differences)
@@ -1867,16 +1889,14 @@ Consensus<Adaptor>::createDisputes(
         typename Result::Dispute_t dtx{
             tx,
             result_->txns.exists(txID),
+            result_->disputePeers,
             std::max(prevProposers_, currPeerPositions_.size()),
             j_};
 
         // Update all of the available peer's votes on the disputed transaction
-        for (auto const& [nodeId, peerPos] : currPeerPositions_)
+        for (auto const& [slot, peerSet] : peerSets)
         {
-            Proposal_t const& peerProp = peerPos.proposal();
-            auto const cit = acquired_.find(peerProp.position());
-            if (cit != acquired_.end() &&
-                dtx.setVote(nodeId, cit->second.exists(txID)))
+            if (dtx.setVote(slot, peerSet->exists(txID)))
                 peerUnchangedCounter_ = 0;
         }
         adaptor_.share(dtx.tx());
@@ -1899,10 +1919,11 @@ Consensus<Adaptor>::updateDisputes(NodeID_t const& node, TxSet_t const& other)
     if (result_->compares.find(other.id()) == result_->compares.end())
         createDisputes(other);
 
+    auto const slot = result_->disputePeers->slot(node);
     for (auto& it : result_->disputes)
     {
         auto& d = it.second;
-        if (d.setVote(node, other.exists(d.tx().id())))
+        if (d.setVote(slot, other.exists(d.tx().id())))
             peerUnchangedCounter_ = 0;
     }
 }
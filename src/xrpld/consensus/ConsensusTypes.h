@@ -27,6 +27,7 @@
 
 #include <chrono>
 #include <map>
+#include <memory>
 
 namespace ripple {
 
@@ -231,12 +232,22 @@ struct ConsensusResult
     //! Transactions which are under dispute with our peers
     hash_map<typename Tx_t::ID, Dispute_t> disputes;
 
+    //! The slots of the peers voting on the disputes
+    std::shared_ptr<typename Dispute_t::Peers> disputePeers =
+        std::make_shared<typename Dispute_t::Peers>();
+
     // Set of TxSet ids we have already compared/created disputes
     hash_set<typename TxSet_t::ID> compares;
 
+    // The duration of the open phase that preceded this consensus round
+    std::chrono::milliseconds openTime{0};
+
     // Measures the duration of the establish phase for this consensus round
     ConsensusTimer roundTime;
 
+    // The number of timer ticks spent in the establish phase
+    std::size_t establishRounds = 0;
+
     // Indicates state in which consensus ended.  Once in the accept phase
     // will be either Yes or MovedOn or Expired
     ConsensusState state = ConsensusState::No;
@@ -23,13 +23,61 @@
 #include <xrpld/consensus/ConsensusParms.h>
 
 #include <xrpl/basics/Log.h>
+#include <xrpl/basics/UnorderedContainers.h>
 #include <xrpl/beast/utility/Journal.h>
 #include <xrpl/json/json_writer.h>
 
-#include <boost/container/flat_map.hpp>
+#include <boost/dynamic_bitset.hpp>
+
+#include <memory>
+#include <optional>
+#include <vector>
 
 namespace ripple {
 
+/** Assigns a dense slot to each peer voting on disputes in a round.
+
+    The slots are shared by all the disputes of a round, so that each
+    dispute can track votes with bit vectors indexed by slot rather than a
+    map keyed by node.
+
+    @tparam NodeID_t The type for a node identifier
+*/
+template <class NodeID_t>
+class DisputePeers
+{
+public:
+    //! The slot of the peer, assigning one if it has none yet.
+    std::size_t
+    slot(NodeID_t const& peer)
+    {
+        auto const [it, inserted] = slots_.emplace(peer, peers_.size());
+        if (inserted)
+            peers_.push_back(peer);
+        return it->second;
+    }
+
+    //! The slot of the peer, if it has one.
+    std::optional<std::size_t>
+    find(NodeID_t const& peer) const
+    {
+        if (auto const it = slots_.find(peer); it != slots_.end())
+            return it->second;
+        return std::nullopt;
+    }
+
+    //! The peer assigned the slot.
+    NodeID_t const&
+    peer(std::size_t slot) const
+    {
+        return peers_[slot];
+    }
+
+private:
+    hash_map<NodeID_t, std::size_t> slots_;
+    std::vector<NodeID_t> peers_;
+};
+
 /** A transaction discovered to be in dispute during consensus.
 
     During consensus, a @ref DisputedTx is created when a transaction
@@ -48,24 +96,44 @@ template <class Tx_t, class NodeID_t>
 class DisputedTx
 {
     using TxID_t = typename Tx_t::ID;
-    using Map_t = boost::container::flat_map<NodeID_t, bool>;
 
 public:
+    using Peers = DisputePeers<NodeID_t>;
+
     /** Constructor
 
         @param tx The transaction under dispute
         @param ourVote Our vote on whether tx should be included
+        @param peers The slots of the peers voting in this round
         @param numPeers Anticipated number of peer votes
         @param j Journal for debugging
     */
     DisputedTx(
         Tx_t const& tx,
         bool ourVote,
+        std::shared_ptr<Peers> peers,
         std::size_t numPeers,
         beast::Journal j)
-        : yays_(0), nays_(0), ourVote_(ourVote), tx_(tx), j_(j)
+        : ourVote_(ourVote), tx_(tx), peers_(std::move(peers)), j_(j)
+    {
+        voted_.reserve(numPeers);
+        yes_.reserve(numPeers);
+    }
+
+    /** Constructor
+
+        @param tx The transaction under dispute
+        @param ourVote Our vote on whether tx should be included
+        @param numPeers Anticipated number of peer votes
+        @param j Journal for debugging
+    */
+    DisputedTx(
+        Tx_t const& tx,
+        bool ourVote,
+        std::size_t numPeers,
+        beast::Journal j)
+        : DisputedTx(tx, ourVote, std::make_shared<Peers>(), numPeers, j)
     {
-        votes_.reserve(numPeers);
     }
 
     //! The unique id/hash of the disputed transaction.
@@ -120,8 +188,10 @@ public:
         // Does this transaction have more than minCONSENSUS_PCT agreement
 
         // Compute the percentage of nodes voting 'yes' (possibly including us)
-        int const support = (yays_ + (proposing && ourVote_ ? 1 : 0)) * 100;
-        int total = nays_ + yays_ + (proposing ? 1 : 0);
+        int const yays = this->yays();
+        int const nays = this->nays();
+        int const support = (yays + (proposing && ourVote_ ? 1 : 0)) * 100;
+        int total = nays + yays + (proposing ? 1 : 0);
         if (!total)
             // There are no votes, so we know nothing
             return false;
@@ -173,6 +243,17 @@ public:
     [[nodiscard]] bool
     setVote(NodeID_t const& peer, bool votesYes);
 
+    /** Change the vote of the peer in the given slot
+
+        @param slot The peer's slot, as assigned by the shared Peers.
+        @param votesYes Whether peer votes to include the disputed transaction.
+
+        @return bool Whether the peer changed its vote. (A new vote counts as a
+       change.)
+    */
+    [[nodiscard]] bool
+    setVote(std::size_t slot, bool votesYes);
+
     /** Remove a peer's vote
 
         @param peer Identifier of peer.
@@ -180,6 +261,13 @@ public:
     void
     unVote(NodeID_t const& peer);
 
+    /** Remove the vote of the peer in the given slot
+
+        @param slot The peer's slot, as assigned by the shared Peers.
+    */
+    void
+    unVote(std::size_t slot);
+
     /** Update our vote given progression of consensus.
 
         Updates our vote on this disputed transaction based on our peers' votes
@@ -199,11 +287,25 @@ public:
     getJson() const;
 
 private:
-    int yays_;      //< Number of yes votes
-    int nays_;      //< Number of no votes
-    bool ourVote_;  //< Our vote (true is yes)
-    Tx_t tx_;       //< Transaction under dispute
-    Map_t votes_;   //< Map from NodeID to vote
+    //! Number of yes votes
+    int
+    yays() const
+    {
+        return static_cast<int>(yes_.count());
+    }
+
+    //! Number of no votes
+    int
+    nays() const
+    {
+        return static_cast<int>(voted_.count() - yes_.count());
+    }
+
+    bool ourVote_;                   //< Our vote (true is yes)
+    Tx_t tx_;                        //< Transaction under dispute
+    std::shared_ptr<Peers> peers_;   //< Slots of the voting peers
+    boost::dynamic_bitset<> voted_;  //< Which slots have voted
+    boost::dynamic_bitset<> yes_;    //< Which slots have voted yes
     //! The number of rounds we've gone without changing our vote
     std::size_t currentVoteCounter_ = 0;
     //! Which minimum acceptance percentage phase we are currently in
@@ -218,42 +320,37 @@ template <class Tx_t, class NodeID_t>
 bool
 DisputedTx<Tx_t, NodeID_t>::setVote(NodeID_t const& peer, bool votesYes)
 {
-    auto const [it, inserted] = votes_.insert(std::make_pair(peer, votesYes));
+    return setVote(peers_->slot(peer), votesYes);
+}
 
-    // new vote
-    if (inserted)
-    {
-        if (votesYes)
-        {
-            JLOG(j_.debug()) << "Peer " << peer << " votes YES on " << tx_.id();
-            ++yays_;
-        }
-        else
-        {
-            JLOG(j_.debug()) << "Peer " << peer << " votes NO on " << tx_.id();
-            ++nays_;
-        }
-        return true;
-    }
-    // changes vote to yes
-    else if (votesYes && !it->second)
+template <class Tx_t, class NodeID_t>
+bool
+DisputedTx<Tx_t, NodeID_t>::setVote(std::size_t slot, bool votesYes)
+{
+    if (slot >= voted_.size())
     {
-        JLOG(j_.debug()) << "Peer " << peer << " now votes YES on " << tx_.id();
-        --nays_;
-        ++yays_;
-        it->second = true;
-        return true;
+        voted_.resize(slot + 1);
+        yes_.resize(slot + 1);
     }
-    // changes vote to no
-    else if (!votesYes && it->second)
+
+    // new vote
+    if (!voted_.test(slot))
     {
-        JLOG(j_.debug()) << "Peer " << peer << " now votes NO on " << tx_.id();
-        ++nays_;
-        --yays_;
-        it->second = false;
+        JLOG(j_.debug()) << "Peer " << peers_->peer(slot) << " votes "
+                         << (votesYes ? "YES" : "NO") << " on " << tx_.id();
+        voted_.set(slot);
+        yes_.set(slot, votesYes);
         return true;
     }
-    return false;
+
+    // unchanged vote
+    if (yes_.test(slot) == votesYes)
+        return false;
+
+    JLOG(j_.debug()) << "Peer " << peers_->peer(slot) << " now votes "
+                     << (votesYes ? "YES" : "NO") << " on " << tx_.id();
+    yes_.set(slot, votesYes);
+    return true;
 }
 
 // Remove a peer's vote on this disputed transaction
@@ -261,16 +358,18 @@ template <class Tx_t, class NodeID_t>
 void
 DisputedTx<Tx_t, NodeID_t>::unVote(NodeID_t const& peer)
 {
-    auto it = votes_.find(peer);
+    if (auto const slot = peers_->find(peer))
+        unVote(*slot);
+}
 
-    if (it != votes_.end())
+template <class Tx_t, class NodeID_t>
+void
+DisputedTx<Tx_t, NodeID_t>::unVote(std::size_t slot)
+{
+    if (slot < voted_.size())
     {
-        if (it->second)
-            --yays_;
-        else
-            --nays_;
-
-        votes_.erase(it);
+        voted_.reset(slot);
+        yes_.reset(slot);
     }
 }
 
@@ -281,10 +380,13 @@ DisputedTx<Tx_t, NodeID_t>::updateVote(
     bool proposing,
     ConsensusParms const& p)
 {
-    if (ourVote_ && (nays_ == 0))
+    int const yays = this->yays();
+    int const nays = this->nays();
+
+    if (ourVote_ && (nays == 0))
         return false;
 
-    if (!ourVote_ && (yays_ == 0))
+    if (!ourVote_ && (yays == 0))
         return false;
 
     bool newPosition;
@@ -307,7 +409,7 @@ DisputedTx<Tx_t, NodeID_t>::updateVote(
     if (proposing)  // give ourselves full weight
     {
         // This is basically the percentage of nodes voting 'yes' (including us)
-        weight = (yays_ * 100 + (ourVote_ ? 100 : 0)) / (nays_ + yays_ + 1);
+        weight = (yays * 100 + (ourVote_ ? 100 : 0)) / (nays + yays + 1);
 
         newPosition = weight > requiredPct;
     }
@@ -315,7 +417,7 @@ DisputedTx<Tx_t, NodeID_t>::updateVote(
     {
         // don't let us outweigh a proposing node, just recognize consensus
         weight = -1;
-        newPosition = yays_ > nays_;
+        newPosition = yays > nays;
     }
 
     if (newPosition == ourVote_)
@@ -345,15 +447,16 @@ DisputedTx<Tx_t, NodeID_t>::getJson() const
 
     Json::Value ret(Json::objectValue);
 
-    ret["yays"] = yays_;
-    ret["nays"] = nays_;
+    ret["yays"] = yays();
+    ret["nays"] = nays();
     ret["our_vote"] = ourVote_;
 
-    if (!votes_.empty())
+    if (voted_.any())
     {
         Json::Value votesj(Json::objectValue);
-        for (auto const& [nodeId, vote] : votes_)
-            votesj[to_string(nodeId)] = vote;
+        for (auto slot = voted_.find_first(); slot != voted_.npos;
+             slot = voted_.find_next(slot))
+            votesj[to_string(peers_->peer(slot))] = yes_.test(slot);
         ret["votes"] = std::move(votesj);
     }
 
@@ -362,6 +362,19 @@ class LedgerTrie
     // Count of the tip support for each sequence number
     std::map<Seq, std::uint32_t> seqSupport;
 
+    // Incremented whenever support changes, so that a cached preferred
+    // ledger can be recognized as stale
+    std::uint64_t supportEpoch = 0;
+
+    // The last preferred ledger computed, and what it was computed for
+    struct CachedPreferred
+    {
+        std::uint64_t epoch;
+        Seq largestIssued;
+        std::optional<SpanTip<Ledger>> tip;
+    };
+    mutable std::optional<CachedPreferred> cachedPreferred;
+
     /** Find the node in the trie that represents the longest common ancestry
         with the given ledger.
 
@@ -439,6 +452,103 @@ class LedgerTrie
         }
     }
 
+    // Walk the trie to find the preferred ledger; see getPreferred
+    std::optional<SpanTip<Ledger>>
+    calcPreferred(Seq const largestIssued) const
+    {
+        if (empty())
+            return std::nullopt;
+
+        Node* curr = root.get();
+
+        bool done = false;
+
+        std::uint32_t uncommitted = 0;
+        auto uncommittedIt = seqSupport.begin();
+
+        while (curr && !done)
+        {
+            // Within a single span, the preferred by branch strategy is simply
+            // to continue along the span as long as the branch support of
+            // the next ledger exceeds the uncommitted support for that ledger.
+            {
+                // Add any initial uncommitted support prior for ledgers
+                // earlier than nextSeq or earlier than largestIssued
+                Seq nextSeq = curr->span.start() + Seq{1};
+                while (uncommittedIt != seqSupport.end() &&
+                       uncommittedIt->first < std::max(nextSeq, largestIssued))
+                {
+                    uncommitted += uncommittedIt->second;
+                    uncommittedIt++;
+                }
+
+                // Advance nextSeq along the span
+                while (nextSeq < curr->span.end() &&
+                       curr->branchSupport > uncommitted)
+                {
+                    // Jump to the next seqSupport change
+                    if (uncommittedIt != seqSupport.end() &&
+                        uncommittedIt->first < curr->span.end())
+                    {
+                        nextSeq = uncommittedIt->first + Seq{1};
+                        uncommitted += uncommittedIt->second;
+                        uncommittedIt++;
+                    }
+                    else  // otherwise we jump to the end of the span
+                        nextSeq = curr->span.end();
+                }
+                // We did not consume the entire span, so we have found the
+                // preferred ledger
+                if (nextSeq < curr->span.end())
+                    return curr->span.before(nextSeq)->tip();
+            }
+
+            // We have reached the end of the current span, so we need to
+            // find the best child
+            Node* best = nullptr;
+            std::uint32_t margin = 0;
+            if (curr->children.size() == 1)
+            {
+                best = curr->children[0].get();
+                margin = best->branchSupport;
+            }
+            else if (!curr->children.empty())
+            {
+                // Sort placing children with largest branch support in the
+                // front, breaking ties with the span's starting ID
+                std::partial_sort(
+                    curr->children.begin(),
+                    curr->children.begin() + 2,
+                    curr->children.end(),
+                    [](std::unique_ptr<Node> const& a,
+                       std::unique_ptr<Node> const& b) {
+                        return std::make_tuple(
+                                   a->branchSupport, a->span.startID()) >
+                            std::make_tuple(
+                                   b->branchSupport, b->span.startID());
+                    });
+
+                best = curr->children[0].get();
+                margin = curr->children[0]->branchSupport -
+                    curr->children[1]->branchSupport;
+
+                // If best holds the tie-breaker, gets one larger margin
+                // since the second best needs additional branchSupport
+                // to overcome the tie
+                if (best->span.startID() > curr->children[1]->span.startID())
+                    margin++;
+            }
+
+            // If the best child has margin exceeding the uncommitted support,
+            // continue from that child, otherwise we are done
+            if (best && ((margin > uncommitted) || (uncommitted == 0)))
+                curr = best;
+            else  // current is the best
+                done = true;
+        }
+        return curr->span.tip();
+    }
+
 public:
     LedgerTrie() : root{std::make_unique<Node>()}
     {
@@ -528,6 +638,7 @@ public:
         }
 
         seqSupport[ledger.seq()] += count;
+        ++supportEpoch;
     }
 
     /** Decrease support for a ledger, removing and compressing if possible.
@@ -548,6 +659,7 @@ public:
         // found our node, remove it
         count = std::min(count, loc->tipSupport);
         loc->tipSupport -= count;
+        ++supportEpoch;
 
         auto const it = seqSupport.find(ledger.seq());
         XRPL_ASSERT(
@@ -676,6 +788,9 @@ public:
         If a preferred ledger does exist, then we continue with the next
         sequence using that ledger as the root.
 
+        The result is cached until support next changes, so repeated queries
+        between validations do not walk the trie again.
+
         @param largestIssued The sequence number of the largest validation
                              issued by this node.
         @return Pair with the sequence number and ID of the preferred ledger or
@@ -684,97 +799,14 @@ public:
     std::optional<SpanTip<Ledger>>
     getPreferred(Seq const largestIssued) const
     {
-        if (empty())
-            return std::nullopt;
-
-        Node* curr = root.get();
-
-        bool done = false;
-
-        std::uint32_t uncommitted = 0;
-        auto uncommittedIt = seqSupport.begin();
-
-        while (curr && !done)
-        {
-            // Within a single span, the preferred by branch strategy is simply
-            // to continue along the span as long as the branch support of
-            // the next ledger exceeds the uncommitted support for that ledger.
-            {
-                // Add any initial uncommitted support prior for ledgers
-                // earlier than nextSeq or earlier than largestIssued
-                Seq nextSeq = curr->span.start() + Seq{1};
-                while (uncommittedIt != seqSupport.end() &&
-                       uncommittedIt->first < std::max(nextSeq, largestIssued))
-                {
-                    uncommitted += uncommittedIt->second;
-                    uncommittedIt++;
-                }
-
-                // Advance nextSeq along the span
-                while (nextSeq < curr->span.end() &&
-                       curr->branchSupport > uncommitted)
-                {
-                    // Jump to the next seqSupport change
-                    if (uncommittedIt != seqSupport.end() &&
-                        uncommittedIt->first < curr->span.end())
-                    {
-                        nextSeq = uncommittedIt->first + Seq{1};
-                        uncommitted += uncommittedIt->second;
-                        uncommittedIt++;
-                    }
-                    else  // otherwise we jump to the end of the span
-                        nextSeq = curr->span.end();
-                }
-                // We did not consume the entire span, so we have found the
-                // preferred ledger
-                if (nextSeq < curr->span.end())
-                    return curr->span.before(nextSeq)->tip();
-            }
+        if (cachedPreferred && cachedPreferred->epoch == supportEpoch &&
+            cachedPreferred->largestIssued == largestIssued)
+            return cachedPreferred->tip;
 
-            // We have reached the end of the current span, so we need to
-            // find the best child
-            Node* best = nullptr;
-            std::uint32_t margin = 0;
-            if (curr->children.size() == 1)
-            {
-                best = curr->children[0].get();
-                margin = best->branchSupport;
-            }
-            else if (!curr->children.empty())
-            {
-                // Sort placing children with largest branch support in the
-                // front, breaking ties with the span's starting ID
-                std::partial_sort(
-                    curr->children.begin(),
-                    curr->children.begin() + 2,
-                    curr->children.end(),
-                    [](std::unique_ptr<Node> const& a,
-                       std::unique_ptr<Node> const& b) {
-                        return std::make_tuple(
-                                   a->branchSupport, a->span.startID()) >
-                            std::make_tuple(
-                                   b->branchSupport, b->span.startID());
-                    });
-
-                best = curr->children[0].get();
-                margin = curr->children[0]->branchSupport -
-                    curr->children[1]->branchSupport;
-
-                // If best holds the tie-breaker, gets one larger margin
-                // since the second best needs additional branchSupport
-                // to overcome the tie
-                if (best->span.startID() > curr->children[1]->span.startID())
-                    margin++;
-            }
-
-            // If the best child has margin exceeding the uncommitted support,
-            // continue from that child, otherwise we are done
-            if (best && ((margin > uncommitted) || (uncommitted == 0)))
-                curr = best;
-            else  // current is the best
-                done = true;
-        }
-        return curr->span.tip();
+        auto tip = calcPreferred(largestIssued);
+        cachedPreferred.emplace(
+            CachedPreferred{supportEpoch, largestIssued, tip});
+        return tip;
     }
 
     /** Return whether the trie is tracking any ledgers
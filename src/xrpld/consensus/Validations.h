@@ -311,10 +311,18 @@ class Validations
     // Sequence of the largest validation received from each node
     hash_map<NodeID, SeqEnforcer<Seq>> seqEnforcers_;
 
+    // Validations for a single ledger, with a running count of the trusted
+    // full ones so queries need not recount them every time
+    struct LedgerValidations
+    {
+        hash_map<NodeID, Validation> validations;
+        std::size_t trustedFull = 0;
+    };
+
     //! Validations from listed nodes, indexed by ledger id (partial and full)
     beast::aged_unordered_map<
         ID,
-        hash_map<NodeID, Validation>,
+        LedgerValidations,
         std::chrono::steady_clock,
         beast::uhash<>>
         byLedger_;
@@ -353,6 +361,12 @@ class Validations
     Adaptor adaptor_;
 
 private:
+    static std::size_t
+    isTrustedFull(Validation const& val)
+    {
+        return (val.trusted() && val.full()) ? 1 : 0;
+    }
+
     // Remove support of a validated ledger
     void
     removeTrie(
@@ -557,8 +571,8 @@ private:
         {
             // Update set time since it is being used
             byLedger_.touch(it);
-            pre(it->second.size());
-            for (auto const& [key, val] : it->second)
+            pre(it->second.validations.size());
+            for (auto const& [key, val] : it->second.validations)
                 f(key, val);
         }
     }
@@ -680,7 +694,17 @@ public:
                 return ValStatus::badSeq;
             }
 
-            byLedger_[val.ledgerID()].insert_or_assign(nodeID, val);
+            {
+                auto& forLedger = byLedger_[val.ledgerID()];
+                auto const [vit, vinserted] =
+                    forLedger.validations.emplace(nodeID, val);
+                if (!vinserted)
+                {
+                    forLedger.trustedFull -= isTrustedFull(vit->second);
+                    vit->second = val;
+                }
+                forLedger.trustedFull += isTrustedFull(val);
+            }
 
             auto const [it, inserted] = current_.emplace(nodeID, val);
             if (!inserted)
@@ -747,7 +771,7 @@ public:
 
                     for (auto i = byLedger_.begin(); i != byLedger_.end(); ++i)
                     {
-                        auto const& validationMap = i->second;
+                        auto const& validationMap = i->second.validations;
                         if (!validationMap.empty())
                         {
                             auto const seq =
@@ -810,18 +834,34 @@ public:
             }
         }
 
-        for (auto& [_, validationMap] : byLedger_)
+        // Copies of a validation may share its trust status, as those of
+        // RCLValidation do, so the loop above may already have flipped the
+        // ones below. Recount the ledgers instead of adjusting the counts.
+        for (auto& [_, forLedger] : byLedger_)
         {
             (void)_;
-            for (auto& [nodeId, validation] : validationMap)
+            bool changed = false;
+            for (auto& [nodeId, validation] : forLedger.validations)
             {
                 if (added.find(nodeId) != added.end())
                 {
                     validation.setTrusted();
+                    changed = true;
                 }
                 else if (removed.find(nodeId) != removed.end())
                 {
                     validation.setUntrusted();
+                    changed = true;
+                }
+            }
+
+            if (changed)
+            {
+                forLedger.trustedFull = 0;
+                for (auto const& [nodeId, validation] : forLedger.validations)
+                {
+                    (void)nodeId;
+                    forLedger.trustedFull += isTrustedFull(validation);
                 }
             }
         }
@@ -1036,17 +1076,14 @@ public:
     std::size_t
     numTrustedForLedger(ID const& ledgerID)
     {
-        std::size_t count = 0;
         std::lock_guard lock{mutex_};
-        byLedger(
-            lock,
-            ledgerID,
-            [&](std::size_t) {},  // nothing to reserve
-            [&](NodeID const&, Validation const& v) {
-                if (v.trusted() && v.full())
-                    ++count;
-            });
-        return count;
+        auto it = byLedger_.find(ledgerID);
+        if (it == byLedger_.end())
+            return 0;
+
+        // Update set time since it is being used
+        byLedger_.touch(it);
+        return it->second.trustedFull;
     }
 
     /**  Get trusted full validations for a specific ledger
@@ -219,6 +219,12 @@ public:
     std::uint32_t LEDGER_HISTORY = 256;
     std::uint32_t FETCH_DEPTH = 1000000000;
 
+    // Bytes the cached ledgers may hold (0 for no limit)
+    std::size_t LEDGER_CACHE_BYTES = 0;
+
+    // Number of hot cache keys to save for a warm restart (0 disables)
+    std::size_t CACHE_SNAPSHOT = 0;
+
     // Tunable that adjusts various parameters, typically associated
     // with hardware parameters (RAM size and CPU cores). The default
     // is 'tiny'.
@@ -247,6 +253,10 @@ public:
     int IO_WORKERS = 0;        // io svc thread count. default: 2
     int PREFETCH_WORKERS = 0;  // prefetch thread count. default: 4
 
+    // Processors the jobqueue and io svc threads may run on (empty = any)
+    std::vector<unsigned> WORKERS_CPUS;
+    std::vector<unsigned> IO_WORKERS_CPUS;
+
     // Can only be set in code, specifically unit tests
     bool FORCE_MULTI_THREAD = false;
 
@@ -45,6 +45,7 @@ struct ConfigSection
 #define SECTION_AMENDMENTS "amendments"
 #define SECTION_AMENDMENT_MAJORITY_TIME "amendment_majority_time"
 #define SECTION_BETA_RPC_API "beta_rpc_api"
+#define SECTION_CACHE_SNAPSHOT "cache_snapshot"
 #define SECTION_CLUSTER_NODES "cluster_nodes"
 #define SECTION_COMPRESSION "compression"
 #define SECTION_DEBUG_LOGFILE "debug_logfile"
@@ -53,8 +54,10 @@ struct ConfigSection
 #define SECTION_FETCH_DEPTH "fetch_depth"
 #define SECTION_INSIGHT "insight"
 #define SECTION_IO_WORKERS "io_workers"
+#define SECTION_IO_WORKERS_CPUS "io_workers_cpus"
 #define SECTION_IPS "ips"
 #define SECTION_IPS_FIXED "ips_fixed"
+#define SECTION_LEDGER_CACHE_MEMORY "ledger_cache_memory"
 #define SECTION_LEDGER_HISTORY "ledger_history"
 #define SECTION_LEDGER_REPLAY "ledger_replay"
 #define SECTION_MAX_TRANSACTIONS "max_transactions"
@@ -99,6 +102,7 @@ struct ConfigSection
 #define SECTION_VALIDATOR_EXCLUSIONS_INTERVAL "validator_exclusions_interval"
 #define SECTION_VETO_AMENDMENTS "veto_amendments"
 #define SECTION_WORKERS "workers"
+#define SECTION_WORKERS_CPUS "workers_cpus"
 
 }  // namespace ripple
 
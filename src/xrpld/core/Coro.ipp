@@ -98,7 +98,8 @@ JobQueue::Coro::resume()
     }
     {
         std::lock_guard lock(jq_.m_mutex);
-        --jq_.nSuspend_;
+        if (--jq_.nSuspend_ == 0)
+            jq_.cv_.notify_all();
     }
     auto saved = detail::getLocalValues().release();
     detail::getLocalValues().reset(&lvs_);
@@ -134,7 +135,8 @@ JobQueue::Coro::expectEarlyExit()
         // That said, since we're outside the Coro's stack, we need to
         // decrement the nSuspend that the Coro's call to yield caused.
         std::lock_guard lock(jq_.m_mutex);
-        --jq_.nSuspend_;
+        if (--jq_.nSuspend_ == 0)
+            jq_.cv_.notify_all();
 #ifndef NDEBUG
         finished_ = true;
 #endif
@@ -23,14 +23,20 @@
 #include <xrpld/core/ClosureCounter.h>
 #include <xrpld/core/JobTypeData.h>
 #include <xrpld/core/JobTypes.h>
+#include <xrpld/core/Task.h>
 #include <xrpld/core/detail/Workers.h>
 
 #include <xrpl/basics/LocalValue.h>
+#include <xrpl/basics/Log.h>
 #include <xrpl/json/json_value.h>
 
 #include <boost/coroutine/all.hpp>
 
+#include <array>
+#include <coroutine>
+#include <deque>
 #include <set>
+#include <vector>
 
 namespace ripple {
 
@@ -44,6 +50,49 @@ struct Coro_create_t
     explicit Coro_create_t() = default;
 };
 
+namespace detail {
+
+// The outermost frame of a Task posted to the JobQueue. It is resumed by
+// a job and frees itself when the task returns.
+struct DetachedTask
+{
+    struct promise_type
+    {
+        DetachedTask
+        get_return_object() noexcept
+        {
+            return {std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always
+        initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never
+        final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        void
+        return_void() const noexcept
+        {
+        }
+
+        // runDetached catches and logs whatever the task throws.
+        void
+        unhandled_exception() const noexcept
+        {
+        }
+    };
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+}  // namespace detail
+
 /** A pool of threads to perform work.
 
     A job posted will always run to completion.
@@ -140,6 +189,105 @@ public:
         join();
     };
 
+    /** A one-shot event that a Task can wait on without holding a thread.
+
+        `co_await signal` suspends the Task until notify() is called, after
+        which it resumes on a new job. While it waits the Task holds only
+        its coroutine frame, and the JobQueue counts it as suspended so
+        that stop() waits for it.
+
+        If the Signal is destroyed while a Task waits on it, or the
+        JobQueue stops first, the Task is resumed all the same and the
+        `co_await` yields false, so that its frame and everything it holds
+        are released. Await a shared Signal with wait() so that the Task
+        does not keep it alive itself.
+
+        Unlike a Coro, a Task has no LocalValues of its own: a LocalValue
+        must not be relied on across a `co_await`.
+    */
+    class Signal
+    {
+    private:
+        friend class JobQueue;
+
+        JobQueue& jq_;
+        JobType type_;
+        std::string name_;
+        std::mutex mutex_;
+        bool notified_ = false;
+
+        // Guarded by the JobQueue's mutex as well, so that stop() can
+        // resume the waiting Task
+        std::coroutine_handle<> waiter_;
+        bool* abandoned_ = nullptr;
+
+        // Take the waiting Task, if any, holding both mutexes
+        std::coroutine_handle<>
+        takeWaiter();
+
+        void
+        wake(std::coroutine_handle<> waiter);
+
+    public:
+        Signal(JobQueue& jq, JobType type, std::string const& name);
+
+        Signal(Signal const&) = delete;
+        Signal&
+        operator=(Signal const&) = delete;
+
+        ~Signal();
+
+        /** Wake the waiting Task.
+
+            If no Task is waiting yet, the next `co_await` does not suspend.
+            If the JobQueue no longer accepts jobs, the Task is resumed on
+            this thread so that it can still run to completion.
+        */
+        void
+        notify();
+
+        struct Awaiter
+        {
+            // Released once the Task is suspended
+            std::shared_ptr<Signal> owner;
+            Signal& signal;
+            bool abandoned = false;
+
+            bool
+            await_ready() const;
+
+            bool
+            await_suspend(std::coroutine_handle<> waiter);
+
+            /** Returns false if the Signal was destroyed unnotified, or
+                the JobQueue stopped while the Task waited.
+            */
+            bool
+            await_resume() const noexcept
+            {
+                return !abandoned;
+            }
+        };
+
+        Awaiter
+        operator co_await() &
+        {
+            return {nullptr, *this};
+        }
+
+        /** Await a shared Signal without owning it while suspended.
+
+            Once the Task is suspended only the notifiers keep the Signal
+            alive. If they all drop it unnotified, the Task resumes.
+        */
+        static Awaiter
+        wait(std::shared_ptr<Signal> signal)
+        {
+            auto& s = *signal;
+            return {std::move(signal), s};
+        }
+    };
+
     using JobFunction = std::function<void()>;
 
     JobQueue(
@@ -147,7 +295,8 @@ public:
         beast::insight::Collector::ptr const& collector,
         beast::Journal journal,
         Logs& logs,
-        perf::PerfLog& perfLog);
+        perf::PerfLog& perfLog,
+        std::vector<unsigned> cpus = {});
     ~JobQueue();
 
     /** Adds a job to the JobQueue.
@@ -188,6 +337,24 @@ public:
     std::shared_ptr<Coro>
     postCoro(JobType t, std::string const& name, F&& f);
 
+    /** Adds a job to the queue which will start a stackless Task.
+
+        Unlike postCoro, nothing is allocated for the task beyond its
+        coroutine frames, so a task suspended on a Signal is cheap to keep.
+        An exception that escapes the task is logged and the task ends.
+
+        @param t The type of job.
+        @param name Name of the job.
+        @param f Has a signature of Task<>(). Called when the job executes.
+       It is kept alive until the task returns, so the task may refer to
+       anything f captures.
+
+        @return true if the task's job is added to the JobQueue.
+    */
+    template <class F>
+    bool
+    postTask(JobType t, std::string const& name, F&& f);
+
     /** Jobs waiting at this priority.
      */
     int
@@ -241,13 +408,24 @@ public:
 
 private:
     friend class Coro;
+    friend class Signal;
 
     using JobDataMap = std::map<JobType, JobTypeData>;
 
     beast::Journal m_journal;
     mutable std::mutex m_mutex;
     std::uint64_t m_lastJob;
-    std::set<Job> m_jobSet;
+
+    // The jobs waiting to run for each type, oldest first
+    std::array<std::deque<Job>, jtNS_WRITE + 1> m_jobQueues;
+
+    // A bit for each type with jobs waiting, so that the highest priority
+    // one can be found without visiting the others
+    std::uint64_t m_waitingTypes = 0;
+    static_assert(jtNS_WRITE < 64, "a job type has no bit");
+
+    // The number of jobs waiting, of all types
+    std::size_t m_waitingJobs = 0;
     JobCounter jobCounter_;
     std::atomic_bool stopping_{false};
     std::atomic_bool stopped_{false};
@@ -260,6 +438,11 @@ private:
     // The number of suspended coroutines
     int nSuspend_ = 0;
 
+    // The Signals that a Task is waiting on. Once stop() has resumed
+    // their Tasks, no Task can wait on a Signal again.
+    std::set<Signal*> waitingSignals_;
+    bool signalsAbandoned_ = false;
+
     Workers m_workers;
 
     // Statistics tracking
@@ -275,6 +458,11 @@ private:
     JobTypeData&
     getJobTypeData(JobType type);
 
+    // Resumes a Task that was suspended on a Signal, and stops counting
+    // it as suspended once it returns or waits again.
+    void
+    resumeSuspended(std::coroutine_handle<> waiter);
+
     // Adds a reference counted job to the JobQueue.
     //
     //    param type The type of job.
@@ -292,15 +480,16 @@ private:
     // Returns the next Job we should run now.
     //
     // RunnableJob:
-    //  A Job in the JobSet whose slots count for its type is greater than zero.
+    //  The oldest waiting Job of a type whose slots count is greater than
+    //  zero.
     //
     // Pre-conditions:
-    //  mJobSet must not be empty.
-    //  mJobSet holds at least one RunnableJob
+    //  m_jobQueues must not all be empty.
+    //  m_jobQueues hold at least one RunnableJob
     //
     // Post-conditions:
     //  job is a valid Job object.
-    //  job is removed from mJobQueue.
+    //  job is removed from m_jobQueues.
     //  Waiting job count of its type is decremented
     //  Running job count of its type is incremented
     //
@@ -312,7 +501,7 @@ private:
     // Indicates that a running Job has completed its task.
     //
     // Pre-conditions:
-    //  Job must not exist in mJobSet.
+    //  Job must not exist in m_jobQueues.
     //  The JobType must not be invalid.
     //
     // Post-conditions:
@@ -328,7 +517,7 @@ private:
     // Runs the next appropriate waiting Job.
     //
     // Pre-conditions:
-    //  A RunnableJob must exist in the JobSet
+    //  A RunnableJob must exist in m_jobQueues
     //
     // Post-conditions:
     //  The chosen RunnableJob will have Job::doJob() called.
@@ -428,6 +617,43 @@ JobQueue::postCoro(JobType t, std::string const& name, F&& f)
     return coro;
 }
 
+namespace detail {
+
+template <class F>
+DetachedTask
+runDetached(F f, beast::Journal j)
+{
+    try
+    {
+        co_await f();
+    }
+    catch (std::exception const& e)
+    {
+        JLOG(j.error()) << "Task threw: " << e.what();
+    }
+    catch (...)
+    {
+        JLOG(j.error()) << "Task threw an unknown exception";
+    }
+}
+
+}  // namespace detail
+
+template <class F>
+bool
+JobQueue::postTask(JobType t, std::string const& name, F&& f)
+{
+    auto const handle =
+        detail::runDetached(std::decay_t<F>(std::forward<F>(f)), m_journal)
+            .handle;
+    if (addJob(t, name, [handle]() { handle.resume(); }))
+        return true;
+
+    // The task will never run, so free it here.
+    handle.destroy();
+    return false;
+}
+
 }  // namespace ripple
 
 #endif
@@ -25,6 +25,8 @@
 #include <xrpl/basics/Log.h>
 #include <xrpl/beast/insight/Collector.h>
 
+#include <atomic>
+
 namespace ripple {
 
 struct JobTypeData
@@ -39,11 +41,13 @@ public:
     /* The job category which we represent */
     JobTypeInfo const& info;
 
-    /* The number of jobs waiting */
-    int waiting;
+    /* The number of jobs waiting. Changed only under the JobQueue lock,
+       but may be read without it. */
+    std::atomic<int> waiting;
 
-    /* The number presently running */
-    int running;
+    /* The number presently running. Changed only under the JobQueue lock,
+       but may be read without it. */
+    std::atomic<int> running;
 
     /* And the number we deferred executing because of job limits */
     int deferred;
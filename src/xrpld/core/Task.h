@@ -0,0 +1,239 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#ifndef RIPPLE_CORE_TASK_H_INCLUDED
+#define RIPPLE_CORE_TASK_H_INCLUDED
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+
+namespace ripple {
+
+template <class T = void>
+class Task;
+
+namespace detail {
+
+class TaskPromiseBase
+{
+    std::coroutine_handle<> continuation_;
+    std::exception_ptr exception_;
+
+    struct FinalAwaiter
+    {
+        bool
+        await_ready() const noexcept
+        {
+            return false;
+        }
+
+        // Hand the thread straight to whoever awaited the task, without
+        // growing the stack.
+        template <class Promise>
+        std::coroutine_handle<>
+        await_suspend(std::coroutine_handle<Promise> h) noexcept
+        {
+            auto& self = static_cast<TaskPromiseBase&>(h.promise());
+            if (self.continuation_)
+                return self.continuation_;
+            return std::noop_coroutine();
+        }
+
+        void
+        await_resume() const noexcept
+        {
+        }
+    };
+
+public:
+    std::suspend_always
+    initial_suspend() const noexcept
+    {
+        return {};
+    }
+
+    FinalAwaiter
+    final_suspend() const noexcept
+    {
+        return {};
+    }
+
+    void
+    unhandled_exception() noexcept
+    {
+        exception_ = std::current_exception();
+    }
+
+    void
+    setContinuation(std::coroutine_handle<> continuation) noexcept
+    {
+        continuation_ = continuation;
+    }
+
+protected:
+    void
+    rethrow() const
+    {
+        if (exception_)
+            std::rethrow_exception(exception_);
+    }
+};
+
+template <class T>
+class TaskPromise : public TaskPromiseBase
+{
+    std::optional<T> value_;
+
+public:
+    Task<T>
+    get_return_object() noexcept;
+
+    template <class U>
+    void
+    return_value(U&& value)
+    {
+        value_.emplace(std::forward<U>(value));
+    }
+
+    T
+    result()
+    {
+        rethrow();
+        return std::move(*value_);
+    }
+};
+
+template <>
+class TaskPromise<void> : public TaskPromiseBase
+{
+public:
+    Task<void>
+    get_return_object() noexcept;
+
+    void
+    return_void() noexcept
+    {
+    }
+
+    void
+    result() const
+    {
+        rethrow();
+    }
+};
+
+}  // namespace detail
+
+/** A stackless coroutine.
+
+    A function returning a Task is a C++20 coroutine whose state lives in a
+    small heap-allocated frame rather than on a stack of its own, so a
+    suspended Task costs only the locals it holds across `co_await`.
+
+    A Task does not run until it is awaited, and its result (or exception)
+    is delivered to the awaiting coroutine. The outermost Task of a chain
+    is started on the JobQueue with JobQueue::postTask.
+
+    @see JobQueue::postTask, JobQueue::Signal
+*/
+template <class T>
+class [[nodiscard]] Task
+{
+public:
+    using promise_type = detail::TaskPromise<T>;
+
+    Task(Task&& other) noexcept : handle_(std::exchange(other.handle_, {}))
+    {
+    }
+
+    Task&
+    operator=(Task&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (handle_)
+                handle_.destroy();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+
+    Task(Task const&) = delete;
+    Task&
+    operator=(Task const&) = delete;
+
+    ~Task()
+    {
+        if (handle_)
+            handle_.destroy();
+    }
+
+    bool
+    await_ready() const noexcept
+    {
+        return false;
+    }
+
+    std::coroutine_handle<>
+    await_suspend(std::coroutine_handle<> awaiting) noexcept
+    {
+        handle_.promise().setContinuation(awaiting);
+        return handle_;
+    }
+
+    T
+    await_resume()
+    {
+        return handle_.promise().result();
+    }
+
+private:
+    friend promise_type;
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    explicit Task(handle_type handle) noexcept : handle_(handle)
+    {
+    }
+
+    handle_type handle_;
+};
+
+namespace detail {
+
+template <class T>
+Task<T>
+TaskPromise<T>::get_return_object() noexcept
+{
+    return Task<T>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+}
+
+inline Task<void>
+TaskPromise<void>::get_return_object() noexcept
+{
+    return Task<void>{std::coroutine_handle<TaskPromise>::from_promise(*this)};
+}
+
+}  // namespace detail
+
+}  // namespace ripple
+
+#endif
@@ -20,6 +20,7 @@
 #include <xrpld/core/Config.h>
 #include <xrpld/core/ConfigSections.h>
 
+#include <xrpl/basics/ByteUtilities.h>
 #include <xrpl/basics/FileUtilities.h>
 #include <xrpl/basics/Log.h>
 #include <xrpl/basics/StringUtilities.h>
@@ -423,6 +424,54 @@ Config::setup(
     get_if_exists(nodeDbSection, "fast_load", FAST_LOAD);
 }
 
+// Parse a list of processors such as "0-3,8,10-11"
+static std::vector<unsigned>
+parseCpuList(std::string const& value, char const* section)
+{
+    auto invalid = [&]() {
+        Throw<std::runtime_error>(
+            std::string("Invalid ") + section +
+            ": must be a comma separated list of processors or ranges of "
+            "processors, such as 0-3,8");
+    };
+
+    std::vector<std::string> ranges;
+    boost::algorithm::split(ranges, value, boost::algorithm::is_any_of(","));
+
+    std::vector<unsigned> cpus;
+    for (auto& range : ranges)
+    {
+        boost::algorithm::trim(range);
+
+        unsigned first = 0;
+        unsigned last = 0;
+        if (auto const dash = range.find('-'); dash != std::string::npos)
+        {
+            if (!beast::lexicalCastChecked(first, range.substr(0, dash)) ||
+                !beast::lexicalCastChecked(last, range.substr(dash + 1)))
+                invalid();
+        }
+        else if (beast::lexicalCastChecked(first, range))
+        {
+            last = first;
+        }
+        else
+        {
+            invalid();
+        }
+
+        if (first > last || last >= 1024)
+            invalid();
+
+        for (auto cpu = first; cpu <= last; ++cpu)
+            cpus.push_back(cpu);
+    }
+
+    std::sort(cpus.begin(), cpus.end());
+    cpus.erase(std::unique(cpus.begin(), cpus.end()), cpus.end());
+    return cpus;
+}
+
 // 0 ports are allowed for unit tests, but still not allowed to be present in
 // config file
 static void
@@ -673,6 +722,23 @@ Config::loadFromString(std::string const& fileContents)
             FETCH_DEPTH = 10;
     }
 
+    if (getSingleSection(secConfig, SECTION_LEDGER_CACHE_MEMORY, strTemp, j_))
+    {
+        if (boost::iequals(strTemp, "none"))
+            LEDGER_CACHE_BYTES = 0;
+        else
+            LEDGER_CACHE_BYTES =
+                megabytes(beast::lexicalCastThrow<std::size_t>(strTemp));
+    }
+
+    if (getSingleSection(secConfig, SECTION_CACHE_SNAPSHOT, strTemp, j_))
+    {
+        if (boost::iequals(strTemp, "none"))
+            CACHE_SNAPSHOT = 0;
+        else
+            CACHE_SNAPSHOT = beast::lexicalCastThrow<std::size_t>(strTemp);
+    }
+
     // By default, validators don't have pathfinding enabled, unless it is
     // explicitly requested by the server's admin.
     if (exists(SECTION_VALIDATION_SEED) || exists(SECTION_VALIDATOR_TOKEN))
@@ -719,6 +785,12 @@ Config::loadFromString(std::string const& fileContents)
                 ": must be between 1 and 1024 inclusive.");
     }
 
+    if (getSingleSection(secConfig, SECTION_WORKERS_CPUS, strTemp, j_))
+        WORKERS_CPUS = parseCpuList(strTemp, SECTION_WORKERS_CPUS);
+
+    if (getSingleSection(secConfig, SECTION_IO_WORKERS_CPUS, strTemp, j_))
+        IO_WORKERS_CPUS = parseCpuList(strTemp, SECTION_IO_WORKERS_CPUS);
+
     if (getSingleSection(secConfig, SECTION_PREFETCH_WORKERS, strTemp, j_))
     {
         PREFETCH_WORKERS = beast::lexicalCastThrow<int>(strTemp);
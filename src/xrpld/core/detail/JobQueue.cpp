@@ -22,7 +22,9 @@
 
 #include <xrpl/basics/contract.h>
 
+#include <bit>
 #include <mutex>
+#include <utility>
 
 namespace ripple {
 
@@ -31,12 +33,19 @@ JobQueue::JobQueue(
     beast::insight::Collector::ptr const& collector,
     beast::Journal journal,
     Logs& logs,
-    perf::PerfLog& perfLog)
+    perf::PerfLog& perfLog,
+    std::vector<unsigned> cpus)
     : m_journal(journal)
     , m_lastJob(0)
     , m_invalidJobData(JobTypes::instance().getInvalid(), collector, logs)
     , m_processCount(0)
-    , m_workers(*this, &perfLog, "JobQueue", threadCount)
+    , m_workers(
+          *this,
+          &perfLog,
+          "JobQueue",
+          threadCount,
+          std::move(cpus),
+          journal)
     , perfLog_(perfLog)
     , m_collector(collector)
 {
@@ -75,7 +84,7 @@ void
 JobQueue::collect()
 {
     std::lock_guard lock(m_mutex);
-    job_count = m_jobSet.size();
+    job_count = m_waitingJobs;
 }
 
 bool
@@ -109,21 +118,12 @@ JobQueue::addRefCountedJob(
 
     {
         std::lock_guard lock(m_mutex);
-        auto result =
-            m_jobSet.emplace(type, name, ++m_lastJob, data.load(), func);
-        auto const& job = *result.first;
-
-        JobType const type(job.getType());
-        XRPL_ASSERT(
-            type != jtINVALID,
-            "ripple::JobQueue::addRefCountedJob : has valid job type");
-        XRPL_ASSERT(
-            m_jobSet.find(job) != m_jobSet.end(),
-            "ripple::JobQueue::addRefCountedJob : job found");
+        m_jobQueues[type].emplace_back(
+            type, name, ++m_lastJob, data.load(), func);
+        m_waitingTypes |= std::uint64_t{1} << type;
+        ++m_waitingJobs;
         perfLog_.jobQueue(type);
 
-        JobTypeData& data(getJobTypeData(type));
-
         if (data.waiting + data.running < getJobLimit(type))
         {
             m_workers.addTask();
@@ -141,18 +141,14 @@ JobQueue::addRefCountedJob(
 int
 JobQueue::getJobCount(JobType t) const
 {
-    std::lock_guard lock(m_mutex);
-
     JobDataMap::const_iterator c = m_jobData.find(t);
 
-    return (c == m_jobData.end()) ? 0 : c->second.waiting;
+    return (c == m_jobData.end()) ? 0 : c->second.waiting.load();
 }
 
 int
 JobQueue::getJobCountTotal(JobType t) const
 {
-    std::lock_guard lock(m_mutex);
-
     JobDataMap::const_iterator c = m_jobData.find(t);
 
     return (c == m_jobData.end()) ? 0 : (c->second.waiting + c->second.running);
@@ -164,8 +160,6 @@ JobQueue::getJobCountGE(JobType t) const
     // return the number of jobs at this priority level or greater
     int ret = 0;
 
-    std::lock_guard lock(m_mutex);
-
     for (auto const& x : m_jobData)
     {
         if (x.first >= t)
@@ -273,7 +267,8 @@ void
 JobQueue::rendezvous()
 {
     std::unique_lock<std::mutex> lock(m_mutex);
-    cv_.wait(lock, [this] { return m_processCount == 0 && m_jobSet.empty(); });
+    cv_.wait(
+        lock, [this] { return m_processCount == 0 && m_waitingJobs == 0; });
 }
 
 JobTypeData&
@@ -298,20 +293,41 @@ JobQueue::stop()
     stopping_ = true;
     using namespace std::chrono_literals;
     jobCounter_.join("JobQueue", 1s, m_journal);
+
+    // No job is left to notify the Tasks still waiting on a Signal, so
+    // resume them as if their Signals had been dropped. Once resumed, a
+    // Task cannot wait on a Signal again, and so cannot hold up the wait
+    // below.
+    std::vector<std::coroutine_handle<>> waiters;
+    {
+        std::lock_guard lock(m_mutex);
+        signalsAbandoned_ = true;
+        for (auto const signal : waitingSignals_)
+        {
+            waiters.push_back(std::exchange(signal->waiter_, {}));
+            *signal->abandoned_ = true;
+        }
+        waitingSignals_.clear();
+    }
+    for (auto const waiter : waiters)
+        resumeSuspended(waiter);
+
     {
         // After the JobCounter is joined, all jobs have finished executing
         // (i.e. returned from `Job::doJob`) and no more are being accepted,
         // but there may still be some threads between the return of
-        // `Job::doJob` and the return of `JobQueue::processTask`. That is why
-        // we must wait on the condition variable to make these assertions.
+        // `Job::doJob` and the return of `JobQueue::processTask`, and some
+        // Tasks may still be waiting on a Signal. That is why we must wait
+        // on the condition variable to make these assertions.
         std::unique_lock<std::mutex> lock(m_mutex);
-        cv_.wait(
-            lock, [this] { return m_processCount == 0 && m_jobSet.empty(); });
+        cv_.wait(lock, [this] {
+            return m_processCount == 0 && m_waitingJobs == 0 && nSuspend_ == 0;
+        });
         XRPL_ASSERT(
             m_processCount == 0,
             "ripple::JobQueue::stop : all processes completed");
         XRPL_ASSERT(
-            m_jobSet.empty(), "ripple::JobQueue::stop : all jobs completed");
+            m_waitingJobs == 0, "ripple::JobQueue::stop : all jobs completed");
         XRPL_ASSERT(
             nSuspend_ == 0, "ripple::JobQueue::stop : no coros suspended");
         stopped_ = true;
@@ -324,18 +340,133 @@ JobQueue::isStopped() const
     return stopped_;
 }
 
+JobQueue::Signal::Signal(JobQueue& jq, JobType type, std::string const& name)
+    : jq_(jq), type_(type), name_(name)
+{
+}
+
+JobQueue::Signal::~Signal()
+{
+    // Nothing can notify a waiting Task now. Resume it anyway, so that its
+    // frame and everything it holds are released.
+    std::coroutine_handle<> waiter;
+    {
+        std::lock_guard lock(mutex_);
+        waiter = takeWaiter();
+        if (waiter)
+            *abandoned_ = true;
+    }
+    if (waiter)
+        wake(waiter);
+}
+
+std::coroutine_handle<>
+JobQueue::Signal::takeWaiter()
+{
+    std::lock_guard lock(jq_.m_mutex);
+    if (waiter_)
+        jq_.waitingSignals_.erase(this);
+    return std::exchange(waiter_, {});
+}
+
+void
+JobQueue::Signal::notify()
+{
+    std::coroutine_handle<> waiter;
+    {
+        std::lock_guard lock(mutex_);
+        XRPL_ASSERT(
+            !notified_, "ripple::JobQueue::Signal::notify : not notified");
+        notified_ = true;
+        waiter = takeWaiter();
+    }
+    if (waiter)
+        wake(waiter);
+}
+
+void
+JobQueue::Signal::wake(std::coroutine_handle<> waiter)
+{
+    // Once resumed, the task may destroy this Signal. It stays counted as
+    // suspended until it returns or waits again, so that stop() waits for
+    // it even when it runs on this thread.
+    auto resume = [&jq = jq_, waiter]() { jq.resumeSuspended(waiter); };
+    if (!jq_.addJob(type_, name_, resume))
+    {
+        // The JobQueue is stopping. Finish the task on this thread rather
+        // than leave it suspended forever.
+        resume();
+    }
+}
+
+void
+JobQueue::resumeSuspended(std::coroutine_handle<> waiter)
+{
+    waiter.resume();
+    std::lock_guard lock(m_mutex);
+    if (--nSuspend_ == 0)
+        cv_.notify_all();
+}
+
+bool
+JobQueue::Signal::Awaiter::await_ready() const
+{
+    std::lock_guard lock(signal.mutex_);
+    return signal.notified_;
+}
+
+bool
+JobQueue::Signal::Awaiter::await_suspend(std::coroutine_handle<> waiter)
+{
+    // Once the lock is released the task may be resumed and this Awaiter
+    // destroyed, so only a local may hold the Signal from then on.
+    auto const keep = std::move(owner);
+    std::lock_guard lock(signal.mutex_);
+    if (signal.notified_)
+        return false;
+
+    if (keep && keep.use_count() == 1)
+    {
+        // Nothing else holds the Signal, so nothing can notify it.
+        abandoned = true;
+        return false;
+    }
+
+    auto& jq = signal.jq_;
+    std::lock_guard jqLock(jq.m_mutex);
+    if (jq.signalsAbandoned_)
+    {
+        // stop() resumed the waiting tasks already, and would not
+        // resume this one
+        abandoned = true;
+        return false;
+    }
+
+    XRPL_ASSERT(
+        !signal.waiter_,
+        "ripple::JobQueue::Signal::Awaiter::await_suspend : one waiter");
+    signal.waiter_ = waiter;
+    signal.abandoned_ = &abandoned;
+    jq.waitingSignals_.insert(&signal);
+    ++jq.nSuspend_;
+    return true;
+}
+
 void
 JobQueue::getNextJob(Job& job)
 {
     XRPL_ASSERT(
-        !m_jobSet.empty(), "ripple::JobQueue::getNextJob : non-empty jobs");
+        m_waitingJobs != 0, "ripple::JobQueue::getNextJob : non-empty jobs");
 
-    std::set<Job>::const_iterator iter;
-    for (iter = m_jobSet.begin(); iter != m_jobSet.end(); ++iter)
+    // Visit the types with jobs waiting, highest priority first
+    for (auto types = m_waitingTypes; types != 0;)
     {
-        JobType const type = iter->getType();
+        auto const type = static_cast<JobType>(std::bit_width(types) - 1);
+        types &= ~(std::uint64_t{1} << type);
+
+        auto& queue = m_jobQueues[type];
         XRPL_ASSERT(
-            type != jtINVALID, "ripple::JobQueue::getNextJob : valid job type");
+            !queue.empty(), "ripple::JobQueue::getNextJob : jobs waiting");
 
         JobTypeData& data(getJobTypeData(type));
         XRPL_ASSERT(
@@ -343,22 +474,24 @@ JobQueue::getNextJob(Job& job)
             "ripple::JobQueue::getNextJob : maximum jobs running");
 
         // Run this job if we're running below the limit.
-        if (data.running < getJobLimit(data.type()))
+        if (data.running < getJobLimit(type))
         {
             XRPL_ASSERT(
                 data.waiting > 0,
                 "ripple::JobQueue::getNextJob : positive data waiting");
             --data.waiting;
             ++data.running;
-            break;
+
+            job = std::move(queue.front());
+            queue.pop_front();
+            if (queue.empty())
+                m_waitingTypes &= ~(std::uint64_t{1} << type);
+            --m_waitingJobs;
+            return;
         }
     }
 
-    XRPL_ASSERT(
-        iter != m_jobSet.end(),
-        "ripple::JobQueue::getNextJob : found next job");
-    job = *iter;
-    m_jobSet.erase(iter);
+    UNREACHABLE("ripple::JobQueue::getNextJob : found next job");
 }
 
 void
@@ -429,7 +562,7 @@ JobQueue::processTask(int instance)
         // otherwise destructors with side effects can access
         // parent objects that are already destroyed.
         finishJob(type);
-        if (--m_processCount == 0 && m_jobSet.empty())
+        if (--m_processCount == 0 && m_waitingJobs == 0)
             cv_.notify_all();
     }
 
@@ -20,6 +20,8 @@
 #include <xrpld/core/detail/Workers.h>
 #include <xrpld/perflog/PerfLog.h>
 
+#include <xrpl/basics/Log.h>
+#include <xrpl/beast/core/CurrentThreadAffinity.h>
 #include <xrpl/beast/core/CurrentThreadName.h>
 #include <xrpl/beast/utility/instrumentation.h>
 
@@ -29,9 +31,13 @@ Workers::Workers(
     Callback& callback,
     perf::PerfLog* perfLog,
     std::string const& threadNames,
-    int numberOfThreads)
+    int numberOfThreads,
+    std::vector<unsigned> cpus,
+    beast::Journal journal)
     : m_callback(callback)
     , perfLog_(perfLog)
+    , m_cpus(std::move(cpus))
+    , j_(journal)
     , m_threadNames(threadNames)
     , m_allPaused(true)
     , m_semaphore(0)
@@ -194,6 +200,14 @@ Workers::Worker::notify()
 void
 Workers::Worker::run()
 {
+    if (!beast::setCurrentThreadAffinity(m_workers.m_cpus) &&
+        !m_workers.m_affinityFailed.exchange(true))
+    {
+        JLOG(m_workers.j_.warn())
+            << "Unable to pin the " << m_workers.m_threadNames
+            << " threads to the configured processors";
+    }
+
     bool shouldExit = true;
     do
     {
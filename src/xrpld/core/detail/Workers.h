@@ -23,12 +23,14 @@
 #include <xrpld/core/detail/semaphore.h>
 
 #include <xrpl/beast/core/LockFreeStack.h>
+#include <xrpl/beast/utility/Journal.h>
 
 #include <atomic>
 #include <condition_variable>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace ripple {
 
@@ -110,13 +112,19 @@ public:
         default is to create one thread per CPU.
 
         @param threadNames The name given to each created worker thread.
+        @param cpus The processors the worker threads may run on, or empty
+                    to let the operating system choose.
+        @param journal Where to report that the threads could not be
+                       restricted to cpus.
     */
     explicit Workers(
         Callback& callback,
         perf::PerfLog* perfLog,
         std::string const& threadNames = "Worker",
         int numberOfThreads =
-            static_cast<int>(std::thread::hardware_concurrency()));
+            static_cast<int>(std::thread::hardware_concurrency()),
+        std::vector<unsigned> cpus = {},
+        beast::Journal journal = beast::Journal{beast::Journal::getNullSink()});
 
     ~Workers();
 
@@ -219,6 +227,9 @@ private:
 private:
     Callback& m_callback;
     perf::PerfLog* perfLog_;
+    std::vector<unsigned> const m_cpus;
+    beast::Journal const j_;
+    std::atomic<bool> m_affinityFailed{false};  // reported once per pool
     std::string m_threadNames;     // The name to give each thread
     std::condition_variable m_cv;  // signaled when all threads paused
     std::mutex m_mut;
@@ -144,6 +144,18 @@ public:
         FetchType fetchType = FetchType::synchronous,
         bool duplicate = false);
 
+    /** Fetch several node objects at once.
+        Backends that can read many keys in one request override this to do
+        so; the default fetches the objects one at a time.
+
+        @note This can be called concurrently.
+        @param hashes The keys of the objects to retrieve.
+        @return The objects, in the order of `hashes`, with `nullptr` for any
+                that couldn't be retrieved.
+    */
+    virtual std::vector<std::shared_ptr<NodeObject>>
+    fetchBatch(std::vector<uint256> const& hashes);
+
     /** Fetch an object without waiting.
         If I/O is required to determine whether or not the object is present,
         `false` is returned. Otherwise, `true` is returned and `object` is set
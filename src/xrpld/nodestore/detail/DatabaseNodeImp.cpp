@@ -190,7 +190,9 @@ DatabaseNodeImp::fetchBatch(std::vector<uint256> const& hashes)
         }
         else
         {
-            JLOG(j_.error())
+            // Callers may ask for objects that online delete has removed,
+            // such as those of a cache snapshot
+            JLOG(j_.trace())
                 << "fetchBatch - "
                 << "record not found in db or cache. hash = " << strHex(hash);
             if (cache_)
@@ -124,7 +124,7 @@ public:
     }
 
     std::vector<std::shared_ptr<NodeObject>>
-    fetchBatch(std::vector<uint256> const& hashes);
+    fetchBatch(std::vector<uint256> const& hashes) override;
 
     void
     asyncFetch(
@@ -67,6 +67,8 @@ public:
         boost::filesystem::path perfLog;
         // log_interval is in milliseconds to support faster testing.
         milliseconds logInterval{seconds(1)};
+        // CPU time between profiler samples, or zero to disable profiling.
+        microseconds sampleInterval{0};
     };
 
     virtual ~PerfLog() = default;
@@ -157,6 +159,18 @@ public:
     virtual Json::Value
     currentJson() const = 0;
 
+    /**
+     * Render the samples taken by the CPU profiler in Json
+     *
+     * @return Sample counts and the heaviest folded stacks, or null if not
+     *         profiling
+     */
+    virtual Json::Value
+    profileJson() const
+    {
+        return Json::nullValue;
+    }
+
     /**
      * Ensure enough room to store each currently executing job
      *
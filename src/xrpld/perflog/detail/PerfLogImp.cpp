@@ -25,6 +25,7 @@
 #include <xrpl/beast/utility/Journal.h>
 #include <xrpl/json/json_writer.h>
 
+#include <algorithm>
 #include <atomic>
 #include <cstdint>
 #include <cstdlib>
@@ -43,13 +44,14 @@ namespace perf {
 PerfLogImp::Counters::Counters(
     std::set<char const*> const& labels,
     JobTypes const& jobTypes)
+    : jobs_(std::make_unique<Locked<JobStart>[]>(maxJobs))
 {
     {
         // populateRpc
         rpc_.reserve(labels.size());
         for (std::string const label : labels)
         {
-            auto const inserted = rpc_.emplace(label, Rpc()).second;
+            auto const inserted = rpc_.emplace(label, rpc_.size()).second;
             if (!inserted)
             {
                 // Ensure that no other function populates this entry.
@@ -66,7 +68,7 @@ PerfLogImp::Counters::Counters(
         jq_.reserve(jobTypes.size());
         for (auto const& [jobType, _] : jobTypes)
         {
-            auto const inserted = jq_.emplace(jobType, Jq()).second;
+            auto const inserted = jq_.emplace(jobType, jq_.size()).second;
             if (!inserted)
             {
                 // Ensure that no other function populates this entry.
@@ -78,26 +80,51 @@ PerfLogImp::Counters::Counters(
             }
         }
     }
+
+    for (auto& shard : shards_)
+    {
+        shard.rpc = std::make_unique<Shard::Rpc[]>(rpc_.size());
+        shard.jq = std::make_unique<Shard::Jq[]>(jq_.size());
+    }
+
+    for (int i = 0; i < maxJobs; ++i)
+        jobs_[i].value = {jtINVALID, steady_time_point()};
+}
+
+PerfLogImp::Counters::Shard&
+PerfLogImp::Counters::shard()
+{
+    // Threads are assigned shards in turn, the first time they use one, so
+    // each shard is updated by as few threads as possible.
+    static std::atomic<std::size_t> next{0};
+    thread_local std::size_t const index =
+        next.fetch_add(1, std::memory_order_relaxed) % shardCount;
+    return shards_[index];
 }
 
 Json::Value
 PerfLogImp::Counters::countersJson() const
 {
+    auto get = [](std::atomic<std::uint64_t> const& counter) {
+        return counter.load(std::memory_order_relaxed);
+    };
+
     Json::Value rpcobj(Json::objectValue);
     // totalRpc represents all rpc methods. All that started, finished, etc.
     Rpc totalRpc;
-    for (auto const& proc : rpc_)
+    for (auto const& [method, index] : rpc_)
     {
         Rpc value;
+        for (auto const& shard : shards_)
         {
-            std::lock_guard lock(proc.second.mutex);
-            if (!proc.second.value.started && !proc.second.value.finished &&
-                !proc.second.value.errored)
-            {
-                continue;
-            }
-            value = proc.second.value;
+            auto const& counters = shard.rpc[index];
+            value.started += get(counters.started);
+            value.finished += get(counters.finished);
+            value.errored += get(counters.errored);
+            value.duration += microseconds{get(counters.durationUs)};
         }
+        if (!value.started && !value.finished && !value.errored)
+            continue;
 
         Json::Value p(Json::objectValue);
         p[jss::started] = std::to_string(value.started);
@@ -108,7 +135,7 @@ PerfLogImp::Counters::countersJson() const
         totalRpc.errored += value.errored;
         p[jss::duration_us] = std::to_string(value.duration.count());
         totalRpc.duration += value.duration;
-        rpcobj[proc.first] = p;
+        rpcobj[method] = p;
     }
 
     if (totalRpc.started)
@@ -125,18 +152,22 @@ PerfLogImp::Counters::countersJson() const
     Json::Value jqobj(Json::objectValue);
     // totalJq represents all jobs. All enqueued, started, finished, etc.
     Jq totalJq;
-    for (auto const& proc : jq_)
+    for (auto const& [jobType, index] : jq_)
     {
         Jq value;
+        for (auto const& shard : shards_)
         {
-            std::lock_guard lock(proc.second.mutex);
-            if (!proc.second.value.queued && !proc.second.value.started &&
-                !proc.second.value.finished)
-            {
-                continue;
-            }
-            value = proc.second.value;
+            auto const& counters = shard.jq[index];
+            value.queued += get(counters.queued);
+            value.started += get(counters.started);
+            value.finished += get(counters.finished);
+            value.queuedDuration +=
+                microseconds{get(counters.queuedDurationUs)};
+            value.runningDuration +=
+                microseconds{get(counters.runningDurationUs)};
         }
+        if (!value.queued && !value.started && !value.finished)
+            continue;
 
         Json::Value j(Json::objectValue);
         j[jss::queued] = std::to_string(value.queued);
@@ -151,7 +182,7 @@ PerfLogImp::Counters::countersJson() const
         j[jss::running_duration_us] =
             std::to_string(value.runningDuration.count());
         totalJq.runningDuration += value.runningDuration;
-        jqobj[JobTypes::name(proc.first)] = j;
+        jqobj[JobTypes::name(jobType)] = j;
     }
 
     if (totalJq.queued)
@@ -181,10 +212,14 @@ PerfLogImp::Counters::currentJson() const
     auto const present = steady_clock::now();
 
     Json::Value jobsArray(Json::arrayValue);
-    auto const jobs = [this] {
-        std::lock_guard lock(jobsMutex_);
-        return jobs_;
-    }();
+    std::vector<JobStart> jobs;
+    auto const workers = workers_.load();
+    jobs.reserve(workers);
+    for (int i = 0; i < workers; ++i)
+    {
+        std::lock_guard lock(jobs_[i].mutex);
+        jobs.push_back(jobs_[i].value);
+    }
 
     for (auto const& j : jobs)
     {
@@ -200,10 +235,10 @@ PerfLogImp::Counters::currentJson() const
 
     Json::Value methodsArray(Json::arrayValue);
     std::vector<MethodStart> methods;
+    for (auto const& shard : methods_)
     {
-        std::lock_guard lock(methodsMutex_);
-        methods.reserve(methods_.size());
-        for (auto const& m : methods_)
+        std::lock_guard lock(shard.mutex);
+        for (auto const& m : shard.value)
             methods.push_back(m.second);
     }
     for (auto m : methods)
@@ -297,16 +332,15 @@ PerfLogImp::report()
 
     Json::Value report(Json::objectValue);
     report[jss::time] = to_string(std::chrono::floor<microseconds>(present));
-    {
-        std::lock_guard lock{counters_.jobsMutex_};
-        report[jss::workers] =
-            static_cast<unsigned int>(counters_.jobs_.size());
-    }
+    report[jss::workers] =
+        static_cast<unsigned int>(counters_.workers_.load());
     report[jss::hostid] = hostname_;
     report[jss::counters] = counters_.countersJson();
     report[jss::nodestore] = Json::objectValue;
     app_.getNodeStore().getCountsJson(report[jss::nodestore]);
     report[jss::current_activities] = counters_.currentJson();
+    if (profiler_)
+        report[jss::profile] = profiler_->getJson(true);
     app_.getOPs().stateAccounting(report);
 
     logFile_ << Json::Compact{std::move(report)} << std::endl;
@@ -317,7 +351,14 @@ PerfLogImp::PerfLogImp(
     Application& app,
     beast::Journal journal,
     std::function<void()>&& signalStop)
-    : setup_(setup), app_(app), j_(journal), signalStop_(std::move(signalStop))
+    : setup_(setup)
+    , app_(app)
+    , j_(journal)
+    , signalStop_(std::move(signalStop))
+    , profiler_(
+          setup.sampleInterval.count() > 0
+              ? std::make_unique<SamplingProfiler>(setup.sampleInterval, j_)
+              : nullptr)
 {
     openLog();
 }
@@ -339,13 +380,13 @@ PerfLogImp::rpcStart(std::string const& method, std::uint64_t const requestId)
         // LCOV_EXCL_STOP
     }
 
-    {
-        std::lock_guard lock(counter->second.mutex);
-        ++counter->second.value.started;
-    }
-    std::lock_guard lock(counters_.methodsMutex_);
-    counters_.methods_[requestId] = {
-        counter->first.c_str(), steady_clock::now()};
+    counters_.shard().rpc[counter->second].started.fetch_add(
+        1, std::memory_order_relaxed);
+    if (profiler_)
+        SamplingProfiler::setMethod(counter->first.c_str());
+    auto& methods = counters_.methods_[requestId % Counters::shardCount];
+    std::lock_guard lock(methods.mutex);
+    methods.value[requestId] = {counter->first.c_str(), steady_clock::now()};
 }
 
 void
@@ -362,14 +403,17 @@ PerfLogImp::rpcEnd(
         return;
         // LCOV_EXCL_STOP
     }
+    if (profiler_)
+        SamplingProfiler::setMethod(nullptr);
     steady_time_point startTime;
     {
-        std::lock_guard lock(counters_.methodsMutex_);
-        auto const e = counters_.methods_.find(requestId);
-        if (e != counters_.methods_.end())
+        auto& methods = counters_.methods_[requestId % Counters::shardCount];
+        std::lock_guard lock(methods.mutex);
+        auto const e = methods.value.find(requestId);
+        if (e != methods.value.end())
         {
             startTime = e->second.second;
-            counters_.methods_.erase(e);
+            methods.value.erase(e);
         }
         else
         {
@@ -379,13 +423,16 @@ PerfLogImp::rpcEnd(
             // LCOV_EXCL_STOP
         }
     }
-    std::lock_guard lock(counter->second.mutex);
+    auto& counters = counters_.shard().rpc[counter->second];
     if (finish)
-        ++counter->second.value.finished;
+        counters.finished.fetch_add(1, std::memory_order_relaxed);
     else
-        ++counter->second.value.errored;
-    counter->second.value.duration += std::chrono::duration_cast<microseconds>(
-        steady_clock::now() - startTime);
+        counters.errored.fetch_add(1, std::memory_order_relaxed);
+    counters.durationUs.fetch_add(
+        std::chrono::duration_cast<microseconds>(
+            steady_clock::now() - startTime)
+            .count(),
+        std::memory_order_relaxed);
 }
 
 void
@@ -400,8 +447,8 @@ PerfLogImp::jobQueue(JobType const type)
         return;
         // LCOV_EXCL_STOP
     }
-    std::lock_guard lock(counter->second.mutex);
-    ++counter->second.value.queued;
+    counters_.shard().jq[counter->second].queued.fetch_add(
+        1, std::memory_order_relaxed);
 }
 
 void
@@ -422,13 +469,19 @@ PerfLogImp::jobStart(
     }
 
     {
-        std::lock_guard lock(counter->second.mutex);
-        ++counter->second.value.started;
-        counter->second.value.queuedDuration += dur;
+        auto& counters = counters_.shard().jq[counter->second];
+        counters.started.fetch_add(1, std::memory_order_relaxed);
+        counters.queuedDurationUs.fetch_add(
+            dur.count(), std::memory_order_relaxed);
+    }
+    if (profiler_)
+        SamplingProfiler::setJob(JobTypes::name(type).c_str());
+    if (instance >= 0 && instance < counters_.workers_.load())
+    {
+        auto& job = counters_.jobs_[instance];
+        std::lock_guard lock(job.mutex);
+        job.value = {type, startTime};
     }
-    std::lock_guard lock(counters_.jobsMutex_);
-    if (instance >= 0 && instance < counters_.jobs_.size())
-        counters_.jobs_[instance] = {type, startTime};
 }
 
 void
@@ -445,21 +498,37 @@ PerfLogImp::jobFinish(JobType const type, microseconds dur, int instance)
     }
 
     {
-        std::lock_guard lock(counter->second.mutex);
-        ++counter->second.value.finished;
-        counter->second.value.runningDuration += dur;
+        auto& counters = counters_.shard().jq[counter->second];
+        counters.finished.fetch_add(1, std::memory_order_relaxed);
+        counters.runningDurationUs.fetch_add(
+            dur.count(), std::memory_order_relaxed);
+    }
+    if (profiler_)
+    {
+        // An RPC method that suspended its coroutine during the job ends on
+        // another thread, and cannot clear its label here itself
+        SamplingProfiler::setJob(nullptr);
+        SamplingProfiler::setMethod(nullptr);
+    }
+    if (instance >= 0 && instance < counters_.workers_.load())
+    {
+        auto& job = counters_.jobs_[instance];
+        std::lock_guard lock(job.mutex);
+        job.value = {jtINVALID, steady_time_point()};
     }
-    std::lock_guard lock(counters_.jobsMutex_);
-    if (instance >= 0 && instance < counters_.jobs_.size())
-        counters_.jobs_[instance] = {jtINVALID, steady_time_point()};
 }
 
 void
 PerfLogImp::resizeJobs(int const resize)
 {
-    std::lock_guard lock(counters_.jobsMutex_);
-    if (resize > counters_.jobs_.size())
-        counters_.jobs_.resize(resize, {jtINVALID, steady_time_point()});
+    // The slots are allocated up front and the count only ever grows, so
+    // the jobs of running workers are never disturbed.
+    auto const workers = std::min(resize, Counters::maxJobs);
+    auto current = counters_.workers_.load();
+    while (workers > current &&
+           !counters_.workers_.compare_exchange_weak(current, workers))
+    {
+    }
 }
 
 void
@@ -476,6 +545,8 @@ PerfLogImp::rotate()
 void
 PerfLogImp::start()
 {
+    if (profiler_)
+        profiler_->start();
     if (setup_.perfLog.size())
         thread_ = std::thread(&PerfLogImp::run, this);
 }
@@ -483,6 +554,8 @@ PerfLogImp::start()
 void
 PerfLogImp::stop()
 {
+    if (profiler_)
+        profiler_->stop();
     if (thread_.joinable())
     {
         {
@@ -515,6 +588,10 @@ setup_PerfLog(Section const& section, boost::filesystem::path const& configDir)
     std::uint64_t logInterval;
     if (get_if_exists(section, "log_interval", logInterval))
         setup.logInterval = std::chrono::seconds(logInterval);
+
+    std::uint64_t sampleInterval;
+    if (get_if_exists(section, "sample_interval", sampleInterval))
+        setup.sampleInterval = std::chrono::milliseconds(sampleInterval);
     return setup;
 }
 
@@ -21,12 +21,15 @@
 #define RIPPLE_BASICS_PERFLOGIMP_H
 
 #include <xrpld/perflog/PerfLog.h>
+#include <xrpld/perflog/detail/SamplingProfiler.h>
 #include <xrpld/rpc/detail/Handler.h>
 
 #include <xrpl/beast/utility/Journal.h>
 
 #include <boost/asio/ip/host_name.hpp>
 
+#include <array>
+#include <atomic>
 #include <condition_variable>
 #include <cstdint>
 #include <fstream>
@@ -68,11 +71,19 @@ class PerfLogImp : public PerfLog
 {
     /**
      * Track performance counters and currently executing tasks.
+     *
+     * The counters are split into shards, each updated by a fixed subset of
+     * threads without locking, and summed when reported. Currently executing
+     * jobs are tracked in a slot per JobQueue worker thread and RPC methods
+     * in maps sharded by request ID, so that threads rarely contend.
      */
     struct Counters
     {
     public:
         using MethodStart = std::pair<char const*, steady_time_point>;
+        using JobStart = std::pair<JobType, steady_time_point>;
+        using Methods = std::unordered_map<std::uint64_t, MethodStart>;
+
         /**
          * RPC performance counters.
          */
@@ -102,16 +113,53 @@ class PerfLogImp : public PerfLog
             microseconds runningDuration{0};
         };
 
-        // rpc_ and jq_ do not need mutex protection because all
-        // keys and values are created before more threads are started.
-        std::unordered_map<std::string, Locked<Rpc>> rpc_;
-        std::unordered_map<JobType, Locked<Jq>> jq_;
-        std::vector<std::pair<JobType, steady_time_point>> jobs_;
-        mutable std::mutex jobsMutex_;
-        std::unordered_map<std::uint64_t, MethodStart> methods_;
-        mutable std::mutex methodsMutex_;
+        /**
+         * One shard of the Rpc and Jq counters, indexed like rpc_ and jq_.
+         */
+        struct Shard
+        {
+            struct Rpc
+            {
+                std::atomic<std::uint64_t> started{0};
+                std::atomic<std::uint64_t> finished{0};
+                std::atomic<std::uint64_t> errored{0};
+                std::atomic<std::uint64_t> durationUs{0};
+            };
+
+            struct Jq
+            {
+                std::atomic<std::uint64_t> queued{0};
+                std::atomic<std::uint64_t> started{0};
+                std::atomic<std::uint64_t> finished{0};
+                std::atomic<std::uint64_t> queuedDurationUs{0};
+                std::atomic<std::uint64_t> runningDurationUs{0};
+            };
+
+            std::unique_ptr<Rpc[]> rpc;
+            std::unique_ptr<Jq[]> jq;
+        };
+
+        static constexpr std::size_t shardCount = 32;
+
+        // The most JobQueue worker threads whose jobs are tracked.
+        static constexpr int maxJobs = 1024;
+
+        // rpc_ and jq_ map each method and job type to its index in the
+        // shards. They do not need mutex protection because all keys and
+        // values are created before more threads are started.
+        std::unordered_map<std::string, std::size_t> rpc_;
+        std::unordered_map<JobType, std::size_t> jq_;
+        std::array<Shard, shardCount> shards_;
+        std::unique_ptr<Locked<JobStart>[]> const jobs_;
+        std::atomic<int> workers_{0};
+        std::array<Locked<Methods>, shardCount> methods_;
 
         Counters(std::set<char const*> const& labels, JobTypes const& jobTypes);
+
+        /** The shard updated by the calling thread. */
+        Shard&
+        shard();
+
         Json::Value
         countersJson() const;
         Json::Value
@@ -123,6 +171,10 @@ class PerfLogImp : public PerfLog
     beast::Journal const j_;
     std::function<void()> const signalStop_;
     Counters counters_{ripple::RPC::getHandlerNames(), JobTypes::instance()};
+    std::unique_ptr<SamplingProfiler> const profiler_;
+
+    // The most stacks profileJson lists, so server_info stays small
+    static constexpr std::size_t profileStacks = 100;
     std::ofstream logFile_;
     std::thread thread_;
     std::mutex mutex_;
@@ -191,6 +243,14 @@ public:
         return counters_.currentJson();
     }
 
+    Json::Value
+    profileJson() const override
+    {
+        if (!profiler_)
+            return Json::nullValue;
+        return profiler_->getJson(false, profileStacks);
+    }
+
     void
     resizeJobs(int const resize) override;
     void
@@ -0,0 +1,376 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#include <xrpld/perflog/detail/SamplingProfiler.h>
+
+#include <xrpl/basics/Log.h>
+#include <xrpl/protocol/jss.h>
+
+#include <boost/predef.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if BOOST_OS_LINUX
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <signal.h>
+#include <sys/time.h>
+#include <sys/uio.h>
+#include <ucontext.h>
+#include <unistd.h>
+#endif
+
+namespace ripple {
+namespace perf {
+
+namespace {
+
+// The most distinct stacks to aggregate. The samples of any further stacks
+// are counted under a single placeholder.
+constexpr std::size_t maxStacks = 65536;
+
+// The furthest apart two consecutive frames may be
+constexpr std::uintptr_t maxFrameSize = 1 << 20;
+
+thread_local char const* currentJob = nullptr;
+thread_local char const* currentMethod = nullptr;
+
+std::atomic<SamplingProfiler*> active{nullptr};
+std::atomic<int> handlersRunning{0};
+
+#if BOOST_OS_LINUX
+// Copy memory that may not be mapped. A system call reports a bad address
+// as an error instead of faulting, and is safe in a signal handler.
+bool
+safeRead(void const* from, void* to, std::size_t size) noexcept
+{
+    iovec local{to, size};
+    iovec remote{const_cast<void*>(from), size};
+    return process_vm_readv(getpid(), &local, 1, &remote, 1, 0) ==
+        static_cast<ssize_t>(size);
+}
+
+// Walk the frame pointers of the interrupted thread. The unwinders of
+// glibc and libgcc take locks, and would deadlock if the signal arrived
+// while the thread held one, for example while throwing an exception.
+//
+// Stacks are only complete in code built with frame pointers, such as with
+// the perf build option. Elsewhere the walk stops early.
+int
+unwind(void* context, void** frames, int maxDepth) noexcept
+{
+#if defined(__x86_64__) || defined(__aarch64__)
+    auto const& mcontext = static_cast<ucontext_t*>(context)->uc_mcontext;
+#if defined(__x86_64__)
+    auto const pc = mcontext.gregs[REG_RIP];
+    auto fp = static_cast<std::uintptr_t>(mcontext.gregs[REG_RBP]);
+#else
+    auto const pc = mcontext.pc;
+    auto fp = static_cast<std::uintptr_t>(mcontext.regs[29]);
+#endif
+
+    int depth = 0;
+    frames[depth++] = reinterpret_cast<void*>(pc);
+    while (depth < maxDepth && fp != 0 && fp % sizeof(void*) == 0)
+    {
+        // The caller's frame pointer, then the return address
+        std::uintptr_t frame[2];
+        if (!safeRead(reinterpret_cast<void*>(fp), frame, sizeof(frame)) ||
+            frame[1] == 0)
+            break;
+
+        frames[depth++] = reinterpret_cast<void*>(frame[1]);
+
+        // Callers' frames are higher up the stack
+        if (frame[0] <= fp || frame[0] - fp > maxFrameSize)
+            break;
+        fp = frame[0];
+    }
+    return depth;
+#else
+    (void)context;
+    (void)frames;
+    (void)maxDepth;
+    return 0;
+#endif
+}
+#endif
+
+}  // namespace
+
+SamplingProfiler::SamplingProfiler(
+    microseconds interval,
+    beast::Journal journal)
+    : interval_(std::max(interval, microseconds{1000}))
+    , j_(journal)
+    , samples_(std::make_unique<Sample[]>(capacity))
+{
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+    stop();
+}
+
+bool
+SamplingProfiler::start()
+{
+    if (running_)
+        return true;
+
+#if BOOST_OS_LINUX
+    SamplingProfiler* expected = nullptr;
+    if (!active.compare_exchange_strong(expected, this))
+    {
+        JLOG(j_.warn()) << "Another sampling profiler is already running";
+        return false;
+    }
+
+    struct sigaction action = {};
+    action.sa_sigaction = [](int, siginfo_t*, void* context) {
+        onSignal(context);
+    };
+    action.sa_flags = SA_RESTART | SA_SIGINFO;
+    sigemptyset(&action.sa_mask);
+
+    itimerval timer = {};
+    timer.it_interval.tv_sec = interval_.count() / 1000000;
+    timer.it_interval.tv_usec = interval_.count() % 1000000;
+    timer.it_value = timer.it_interval;
+
+    if (sigaction(SIGPROF, &action, nullptr) != 0 ||
+        setitimer(ITIMER_PROF, &timer, nullptr) != 0)
+    {
+        JLOG(j_.error()) << "Unable to start the sampling profiler: "
+                         << std::strerror(errno);
+        active = nullptr;
+        return false;
+    }
+
+    running_ = true;
+    JLOG(j_.info()) << "Sampling profiler started, taking a sample every "
+                    << interval_.count() << "us of CPU time";
+    return true;
+#else
+    JLOG(j_.warn()) << "The sampling profiler is not supported on this "
+                       "platform";
+    return false;
+#endif
+}
+
+void
+SamplingProfiler::stop()
+{
+    if (!running_)
+        return;
+
+#if BOOST_OS_LINUX
+    itimerval timer = {};
+    setitimer(ITIMER_PROF, &timer, nullptr);
+
+    // The handler stays installed, since a signal may still be pending and
+    // its default action would terminate the process. Wait for any handler
+    // that is still recording into our buffer.
+    active = nullptr;
+    while (handlersRunning != 0)
+        std::this_thread::yield();
+#endif
+
+    running_ = false;
+}
+
+void
+SamplingProfiler::setJob(char const* name) noexcept
+{
+    currentJob = name;
+}
+
+void
+SamplingProfiler::setMethod(char const* name) noexcept
+{
+    currentMethod = name;
+}
+
+void
+SamplingProfiler::onSignal(void* context)
+{
+    int const savedErrno = errno;
+
+    ++handlersRunning;
+    if (auto const profiler = active.load())
+    {
+#if BOOST_OS_LINUX
+        void* frames[maxDepth];
+        profiler->record(frames, unwind(context, frames, maxDepth));
+#else
+        (void)profiler;
+        (void)context;
+#endif
+    }
+    --handlersRunning;
+
+    errno = savedErrno;
+}
+
+void
+SamplingProfiler::record(void* const* frames, int depth) noexcept
+{
+    auto& sample =
+        samples_[next_.fetch_add(1, std::memory_order_relaxed) % capacity];
+
+    // The buffer is full if the slot still holds a sample
+    int expected = Sample::free;
+    if (!sample.state.compare_exchange_strong(
+            expected, Sample::writing, std::memory_order_acquire))
+    {
+        overflows_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    sample.job = currentJob;
+    sample.method = currentMethod;
+    sample.depth = depth;
+    std::copy(frames, frames + depth, sample.frames);
+    sample.state.store(Sample::ready, std::memory_order_release);
+}
+
+void
+SamplingProfiler::drain()
+{
+    std::string stack;
+    for (std::size_t i = 0; i < capacity; ++i)
+    {
+        auto& sample = samples_[i];
+        if (sample.state.load(std::memory_order_acquire) != Sample::ready)
+            continue;
+
+        stack = sample.job ? sample.job : "other";
+        if (sample.method)
+        {
+            stack += ';';
+            stack += sample.method;
+        }
+        for (int frame = sample.depth; frame-- > 0;)
+        {
+            stack += ';';
+            stack += symbol(sample.frames[frame]);
+        }
+
+        sample.state.store(Sample::free, std::memory_order_release);
+
+        ++taken_.total;
+        if (stacks_.size() >= maxStacks && !stacks_.contains(stack))
+            stack = "(too many stacks)";
+        ++stacks_[stack].total;
+    }
+
+    dropped_.total = overflows_.load(std::memory_order_relaxed);
+}
+
+std::string const&
+SamplingProfiler::symbol(void* address)
+{
+    auto [it, inserted] = symbols_.try_emplace(address);
+    if (!inserted)
+        return it->second;
+
+    std::ostringstream name;
+#if BOOST_OS_LINUX
+    Dl_info info;
+    if (dladdr(address, &info) != 0 && info.dli_sname)
+    {
+        int status = 0;
+        std::unique_ptr<char, decltype(&std::free)> const demangled{
+            abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status),
+            &std::free};
+        name << (status == 0 ? demangled.get() : info.dli_sname);
+    }
+    else if (info.dli_fname)
+    {
+        // Not exported, so leave it for symbolizing offline
+        std::string_view module{info.dli_fname};
+        module.remove_prefix(module.rfind('/') + 1);
+        name << module << "+0x" << std::hex
+             << (static_cast<char*>(address) -
+                 static_cast<char*>(info.dli_fbase));
+    }
+    else
+#endif
+    {
+        name << address;
+    }
+
+    it->second = name.str();
+    return it->second;
+}
+
+Json::Value
+SamplingProfiler::getJson(bool sinceLastReport, std::size_t limit)
+{
+    std::lock_guard lock(mutex_);
+    drain();
+
+    auto count = [sinceLastReport](Count& c) {
+        auto const n = sinceLastReport ? c.total - c.reported : c.total;
+        if (sinceLastReport)
+            c.reported = c.total;
+        return n;
+    };
+
+    std::vector<std::pair<std::uint64_t, std::string const*>> stacks;
+    for (auto& [stack, c] : stacks_)
+    {
+        if (auto const n = count(c))
+            stacks.emplace_back(n, &stack);
+    }
+    std::sort(stacks.begin(), stacks.end(), [](auto const& a, auto const& b) {
+        return a.first > b.first;
+    });
+
+    Json::Value ret(Json::objectValue);
+    ret[jss::sample_interval_us] = std::to_string(interval_.count());
+    ret[jss::samples] = std::to_string(count(taken_));
+    ret[jss::dropped] = std::to_string(count(dropped_));
+
+    // The lighter stacks beyond the limit are reported as one
+    std::uint64_t others = 0;
+    Json::Value& folded = ret[jss::stacks] = Json::arrayValue;
+    for (auto const& [n, stack] : stacks)
+    {
+        if (folded.size() < limit)
+            folded.append(*stack + ' ' + std::to_string(n));
+        else
+            others += n;
+    }
+    if (others != 0)
+        folded.append("(other stacks) " + std::to_string(others));
+
+    return ret;
+}
+
+}  // namespace perf
+}  // namespace ripple
@@ -0,0 +1,170 @@
+//------------------------------------------------------------------------------
+/*
+    This file is part of rippled: https://github.com/ripple/rippled
+    Copyright (c) 2025 Ripple Labs Inc.
+
+    Permission to use, copy, modify, and/or distribute this software for any
+    purpose  with  or without fee is hereby granted, provided that the above
+    copyright notice and this permission notice appear in all copies.
+
+    THE  SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+    WITH  REGARD  TO  THIS  SOFTWARE  INCLUDING  ALL  IMPLIED  WARRANTIES  OF
+    MERCHANTABILITY  AND  FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+    ANY  SPECIAL ,  DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+    WHATSOEVER  RESULTING  FROM  LOSS  OF USE, DATA OR PROFITS, WHETHER IN AN
+    ACTION  OF  CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+    OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+//==============================================================================
+
+#ifndef RIPPLE_BASICS_SAMPLINGPROFILER_H
+#define RIPPLE_BASICS_SAMPLINGPROFILER_H
+
+#include <xrpl/beast/utility/Journal.h>
+#include <xrpl/json/json_value.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ripple {
+namespace perf {
+
+/**
+ * In-process sampling CPU profiler.
+ *
+ * While running, every thread that consumes CPU is interrupted by SIGPROF
+ * at the configured interval of CPU time. The signal handler captures the
+ * call stack of the interrupted thread into a fixed size buffer, along with
+ * the job type and RPC method the thread is running, if any. The samples
+ * are aggregated later, off the signal handler, into folded stacks:
+ *
+ *     job;method;outermost frame;...;innermost frame count
+ *
+ * which is the input format of common flame graph tools. Frames are named
+ * from the dynamic symbol table where possible, and are otherwise reported
+ * as an offset into their module for offline symbolization.
+ *
+ * The call stack is found by following frame pointers, which is safe in a
+ * signal handler. Code built without them, which compilers omit by default
+ * when optimizing, is reported with truncated stacks.
+ *
+ * Only one profiler can run at a time, and only on Linux.
+ */
+class SamplingProfiler
+{
+public:
+    using microseconds = std::chrono::microseconds;
+
+    SamplingProfiler(microseconds interval, beast::Journal journal);
+
+    ~SamplingProfiler();
+
+    SamplingProfiler(SamplingProfiler const&) = delete;
+    SamplingProfiler&
+    operator=(SamplingProfiler const&) = delete;
+
+    /**
+     * Start taking samples.
+     *
+     * @return Whether sampling started
+     */
+    bool
+    start();
+
+    /**
+     * Stop taking samples. Samples already taken remain available.
+     */
+    void
+    stop();
+
+    /**
+     * Label the samples taken on the calling thread with the job type or
+     * RPC method it is running.
+     *
+     * Both labels are cleared when a job finishes. An RPC method that
+     * suspends its coroutine and resumes on another thread is then counted
+     * under the job alone, rather than under whatever runs next on the
+     * thread it left.
+     *
+     * @param name The label, or nullptr to clear it. The string must
+     *             outlive the profiler.
+     */
+    static void
+    setJob(char const* name) noexcept;
+
+    static void
+    setMethod(char const* name) noexcept;
+
+    /**
+     * Render the aggregated samples in Json.
+     *
+     * @param sinceLastReport Only count the samples taken since the previous
+     *                        call with this set, instead of all of them.
+     * @param limit The most stacks to list. The samples of the rest are
+     *              counted under a single placeholder.
+     * @return Sample counts and folded stacks, heaviest first
+     */
+    Json::Value
+    getJson(
+        bool sinceLastReport = false,
+        std::size_t limit = std::numeric_limits<std::size_t>::max());
+
+private:
+    static constexpr std::size_t capacity = 4096;
+    static constexpr int maxDepth = 64;
+
+    struct Sample
+    {
+        // free, being written by the signal handler, or ready to aggregate
+        enum : int { free, writing, ready };
+
+        std::atomic<int> state{free};
+        char const* job = nullptr;
+        char const* method = nullptr;
+        int depth = 0;
+        void* frames[maxDepth];
+    };
+
+    struct Count
+    {
+        std::uint64_t total = 0;
+        std::uint64_t reported = 0;
+    };
+
+    // context is the ucontext_t of the interrupted thread
+    static void
+    onSignal(void* context);
+
+    void
+    record(void* const* frames, int depth) noexcept;
+
+    void
+    drain();
+
+    std::string const&
+    symbol(void* address);
+
+    microseconds const interval_;
+    beast::Journal const j_;
+    std::unique_ptr<Sample[]> const samples_;
+    std::atomic<std::size_t> next_{0};
+    std::atomic<std::uint64_t> overflows_{0};
+    bool running_{false};
+
+    std::mutex mutex_;
+    Count taken_;
+    Count dropped_;
+    std::unordered_map<std::string, Count> stacks_;
+    std::unordered_map<void*, std::string> symbols_;
+};
+
+}  // namespace perf
+}  // namespace ripple
+
+#endif  // RIPPLE_BASICS_SAMPLINGPROFILER_H
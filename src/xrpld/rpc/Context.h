@@ -21,10 +21,17 @@
 #define RIPPLE_RPC_CONTEXT_H_INCLUDED
 
 #include <xrpld/core/JobQueue.h>
+#include <xrpld/perflog/PerfLog.h>
 #include <xrpld/rpc/InfoSub.h>
 #include <xrpld/rpc/Role.h>
 
 #include <xrpl/beast/utility/Journal.h>
+#include <xrpl/protocol/RPCErr.h>
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
 
 namespace ripple {
 
@@ -34,6 +41,107 @@ class LedgerMaster;
 
 namespace RPC {
 
+/** The remainder of a handler that has to wait on other work.
+
+    A caller running the request as a stackless Task offers one of these
+    in the Context. Rather than suspend a Coro, the handler then returns
+    early, arranging for signal() to be notified when its wait is over
+    and passing defer() the code that completes its result. The caller
+    awaits complete() before it looks at the result, so a waiting request
+    keeps no thread and no stack.
+*/
+class Deferred
+{
+private:
+    JobQueue& jq_;
+    JobType type_;
+    std::string name_;
+    std::shared_ptr<JobQueue::Signal> signal_;
+    std::function<void(Json::Value&)> finish_;
+
+    // The call to report to the PerfLog once the result is complete
+    perf::PerfLog* perfLog_ = nullptr;
+    std::string method_;
+    std::uint64_t requestId_ = 0;
+
+public:
+    Deferred(JobQueue& jq, JobType type, std::string const& name)
+        : jq_(jq), type_(type), name_(name)
+    {
+    }
+
+    /** The signal that ends the handler's wait. */
+    std::shared_ptr<JobQueue::Signal> const&
+    signal()
+    {
+        if (!signal_)
+            signal_ = std::make_shared<JobQueue::Signal>(jq_, type_, name_);
+        return signal_;
+    }
+
+    /** Complete the result with `finish` once signal() is notified. */
+    void
+    defer(std::function<void(Json::Value&)> finish)
+    {
+        finish_ = std::move(finish);
+    }
+
+    /** Report the end of the call to `perfLog` when complete() is done.
+
+        The handler returning is not the end of a deferred call, so the
+        caller that started it in the PerfLog hands its end over here.
+    */
+    void
+    track(
+        perf::PerfLog& perfLog,
+        std::string const& method,
+        std::uint64_t requestId)
+    {
+        perfLog_ = &perfLog;
+        method_ = method;
+        requestId_ = requestId;
+    }
+
+    /** Returns true if the handler deferred its result. */
+    explicit operator bool() const
+    {
+        return static_cast<bool>(finish_);
+    }
+
+    /** Wait for the handler's signal, then complete its result.
+
+        Only the handler's side holds the signal during the wait. If it
+        is dropped without being notified, the result is an internal
+        error rather than a request that never completes.
+    */
+    Task<>
+    complete(Json::Value& result)
+    {
+        signal();
+        auto const finish = std::exchange(finish_, {});
+        if (!co_await JobQueue::Signal::wait(std::exchange(signal_, {})))
+        {
+            result = rpcError(rpcINTERNAL);
+            if (perfLog_)
+                perfLog_->rpcError(method_, requestId_);
+            co_return;
+        }
+
+        try
+        {
+            finish(result);
+        }
+        catch (...)
+        {
+            if (perfLog_)
+                perfLog_->rpcError(method_, requestId_);
+            throw;
+        }
+        if (perfLog_)
+            perfLog_->rpcFinish(method_, requestId_);
+    }
+};
+
 /** The context of information needed to call an RPC. */
 struct Context
 {
@@ -47,6 +155,7 @@ struct Context
     std::shared_ptr<JobQueue::Coro> coro{};
     InfoSub::pointer infoSub{};
     unsigned int apiVersion;
+    Deferred* deferred = nullptr;
 };
 
 struct JsonContext : public Context
@@ -26,8 +26,14 @@
 #include <xrpl/json/json_value.h>
 #include <xrpl/protocol/Book.h>
 #include <xrpl/protocol/ErrorCodes.h>
+#include <xrpl/protocol/MultiApiJson.h>
 #include <xrpl/resource/Consumer.h>
 
+#include <array>
+#include <memory>
+#include <mutex>
+#include <string>
+
 namespace ripple {
 
 // Operations that clients may wish to perform against the network
@@ -46,6 +52,35 @@ public:
     doStatus(Json::Value const&) = 0;
 };
 
+/** A published event shared by every subscriber it is sent to.
+
+    The JSON is serialized the first time a subscriber asks for the wire
+    form, and the resulting immutable buffer is then shared by reference
+    with every other subscriber instead of being rendered again.
+*/
+class InfoSubMessage
+{
+public:
+    using pointer = std::shared_ptr<InfoSubMessage const>;
+
+    explicit InfoSubMessage(Json::Value jv);
+
+    Json::Value const&
+    json() const
+    {
+        return jv_;
+    }
+
+    /** Return the compact serialization, rendering it on first use. */
+    std::shared_ptr<std::string const> const&
+    text() const;
+
+private:
+    Json::Value const jv_;
+    mutable std::once_flag rendered_;
+    mutable std::shared_ptr<std::string const> text_;
+};
+
 /** Manages a client's subscription to data feeds.
  */
 class InfoSub : public CountedObject<InfoSub>
@@ -201,6 +236,14 @@ public:
     virtual void
     send(Json::Value const& jvObj, bool broadcast) = 0;
 
+    /** Send a message which may be shared with other subscribers.
+
+        Subscribers that can transmit the serialized form directly should
+        override this; the default sends the underlying JSON.
+    */
+    virtual void
+    send(InfoSubMessage::pointer const& msg, bool broadcast);
+
     std::uint64_t
     getSeq();
 
@@ -256,6 +299,30 @@ private:
     }
 };
 
+/** One shared message per supported API version.
+
+    Built once per published event from the MultiApiJson describing it, so
+    that broadcasting costs one pointer copy per subscriber.
+*/
+class MultiApiMessage
+{
+public:
+    explicit MultiApiMessage(MultiApiJson jv);
+
+    InfoSubMessage::pointer const&
+    at(unsigned int apiVersion) const;
+
+    /** Send the message matching the subscriber's API version. */
+    void
+    send(InfoSub& sub, bool broadcast) const
+    {
+        sub.send(at(sub.getApiVersion()), broadcast);
+    }
+
+private:
+    std::array<InfoSubMessage::pointer, MultiApiJson::size> msgs_;
+};
+
 }  // namespace ripple
 
 #endif
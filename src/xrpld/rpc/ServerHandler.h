@@ -192,24 +192,26 @@ public:
     onStopped(Server&);
 
 private:
-    Json::Value
+    Task<Json::Value>
     processSession(
         std::shared_ptr<WSSession> const& session,
-        std::shared_ptr<JobQueue::Coro> const& coro,
         Json::Value const& jv);
 
-    void
-    processSession(
-        std::shared_ptr<Session> const&,
-        std::shared_ptr<JobQueue::Coro> coro);
+    Task<>
+    processSession(std::shared_ptr<Session> const& session);
 
-    void
+    /** Process a JSON-RPC request received over HTTP.
+
+        Errors are written directly to `output`. Otherwise, the returned
+        writer produces the reply and must be handed to the session.
+    */
+    Task<std::shared_ptr<Writer>>
     processRequest(
         Port const& port,
         std::string const& request,
         beast::IP::Endpoint const& remoteIPAddress,
         Output&&,
-        std::shared_ptr<JobQueue::Coro> coro,
+        bool chunked,
         std::string_view forwardedFor,
         std::string_view user);
 
@@ -19,6 +19,10 @@
 
 #include <xrpld/rpc/InfoSub.h>
 
+#include <xrpl/json/json_writer.h>
+
+#include <utility>
+
 namespace ripple {
 
 // This is the primary interface into the "client" portion of the program.
@@ -32,6 +36,39 @@ namespace ripple {
 // code assumes this node is synched (and will continue to do so until
 // there's a functional network.
 
+InfoSubMessage::InfoSubMessage(Json::Value jv) : jv_(std::move(jv))
+{
+}
+
+std::shared_ptr<std::string const> const&
+InfoSubMessage::text() const
+{
+    std::call_once(rendered_, [this]() {
+        std::string s;
+        Json::stream(jv_, [&s](void const* data, std::size_t n) {
+            s.append(static_cast<char const*>(data), n);
+        });
+        text_ = std::make_shared<std::string const>(std::move(s));
+    });
+    return text_;
+}
+
+MultiApiMessage::MultiApiMessage(MultiApiJson jv)
+{
+    for (std::size_t i = 0; i < msgs_.size(); ++i)
+        msgs_[i] =
+            std::make_shared<InfoSubMessage const>(std::move(jv.val[i]));
+}
+
+InfoSubMessage::pointer const&
+MultiApiMessage::at(unsigned int apiVersion) const
+{
+    XRPL_ASSERT(
+        MultiApiJson::valid(apiVersion),
+        "ripple::MultiApiMessage::at : valid version");
+    return msgs_[MultiApiJson::index(apiVersion)];
+}
+
 InfoSub::InfoSub(Source& source) : m_source(source), mSeq(assign_id())
 {
 }
@@ -64,6 +101,12 @@ InfoSub::~InfoSub()
         m_source.unsubAccountHistoryInternal(mSeq, account, false);
 }
 
+void
+InfoSub::send(InfoSubMessage::pointer const& msg, bool broadcast)
+{
+    send(msg->json(), broadcast);
+}
+
 Resource::Consumer&
 InfoSub::getConsumer()
 {
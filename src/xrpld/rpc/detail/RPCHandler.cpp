@@ -200,7 +200,10 @@ callMethod(
         JLOG(context.j.debug())
             << "RPC call " << name << " completed in "
             << ((end - start).count() / 1000000000.0) << "seconds";
-        perfLog.rpcFinish(name, curId);
+        if (context.deferred && *context.deferred)
+            context.deferred->track(perfLog, name, curId);
+        else
+            perfLog.rpcFinish(name, curId);
         return ret;
     }
     catch (std::exception& e)
@@ -75,6 +75,8 @@ public:
 
     ~RPCSubImp() = default;
 
+    using InfoSub::send;
+
     void
     send(Json::Value const& jvObj, bool broadcast) override
     {
@@ -314,15 +314,13 @@ ServerHandler::onRequest(Session& session)
     }
 
     std::shared_ptr<Session> detachedSession = session.detach();
-    auto const postResult = m_jobQueue.postCoro(
-        jtCLIENT_RPC,
-        "RPC-Client",
-        [this, detachedSession](std::shared_ptr<JobQueue::Coro> coro) {
-            processSession(detachedSession, coro);
+    auto const posted = m_jobQueue.postTask(
+        jtCLIENT_RPC, "RPC-Client", [this, detachedSession]() -> Task<> {
+            co_await processSession(detachedSession);
         });
-    if (postResult == nullptr)
+    if (!posted)
     {
-        // The coroutine was rejected, probably because we're shutting down.
+        // The task was rejected, probably because we're shutting down.
         HTTPReply(
             503,
             "Service Unavailable",
@@ -361,24 +359,17 @@ ServerHandler::onWSMessage(
 
     JLOG(m_journal.trace()) << "Websocket received '" << jv << "'";
 
-    auto const postResult = m_jobQueue.postCoro(
+    auto const posted = m_jobQueue.postTask(
         jtCLIENT_WEBSOCKET,
         "WS-Client",
-        [this, session, jv = std::move(jv)](
-            std::shared_ptr<JobQueue::Coro> const& coro) {
-            auto const jr = this->processSession(session, coro, jv);
-            auto const s = to_string(jr);
-            auto const n = s.length();
-            boost::beast::multi_buffer sb(n);
-            sb.commit(boost::asio::buffer_copy(
-                sb.prepare(n), boost::asio::buffer(s.c_str(), n)));
-            session->send(
-                std::make_shared<StreambufWSMsg<decltype(sb)>>(std::move(sb)));
+        [this, session, jv = std::move(jv)]() -> Task<> {
+            auto jr = co_await processSession(session, jv);
+            session->send(std::make_shared<JsonWSMsg>(std::move(jr)));
             session->complete();
         });
-    if (postResult == nullptr)
+    if (!posted)
     {
-        // The coroutine was rejected, probably because we're shutting down.
+        // The task was rejected, probably because we're shutting down.
         session->close({boost::beast::websocket::going_away, "Shutting Down"});
     }
 }
@@ -419,10 +410,9 @@ logDuration(
                 << " microseconds. request = " << request;
 }
 
-Json::Value
+Task<Json::Value>
 ServerHandler::processSession(
     std::shared_ptr<WSSession> const& session,
-    std::shared_ptr<JobQueue::Coro> const& coro,
     Json::Value const& jv)
 {
     auto is = std::static_pointer_cast<WSInfoSub>(session->appDefined);
@@ -432,7 +422,7 @@ ServerHandler::processSession(
             {boost::beast::websocket::policy_error, "threshold exceeded"});
         // FIX: This rpcError is not delivered since the session
         // was just closed.
-        return rpcError(rpcSLOW_DOWN);
+        co_return rpcError(rpcSLOW_DOWN);
     }
 
     // Requests without "command" are invalid.
@@ -465,7 +455,7 @@ ServerHandler::processSession(
                 jr[jss::api_version] = jv[jss::api_version];
 
             is->getConsumer().charge(Resource::feeMalformedRPC);
-            return jr;
+            co_return jr;
         }
 
         auto required = RPC::roleRequired(
@@ -486,6 +476,7 @@ ServerHandler::processSession(
         }
         else
         {
+            RPC::Deferred deferred{m_jobQueue, jtCLIENT_WEBSOCKET, "WS-Client"};
             RPC::JsonContext context{
                 {app_.journal("RPCHandler"),
                  app_,
@@ -494,14 +485,17 @@ ServerHandler::processSession(
                  app_.getLedgerMaster(),
                  is->getConsumer(),
                  role,
-                 coro,
+                 {},
                  is,
-                 apiVersion},
+                 apiVersion,
+                 &deferred},
                 jv,
                 {is->user(), is->forwarded_for()}};
 
             auto start = std::chrono::system_clock::now();
             RPC::doCommand(context, jr[jss::result]);
+            if (deferred)
+                co_await deferred.complete(jr[jss::result]);
             auto end = std::chrono::system_clock::now();
             logDuration(jv, end - start, m_journal);
         }
@@ -564,21 +558,18 @@ ServerHandler::processSession(
         jr[jss::api_version] = jv[jss::api_version];
 
     jr[jss::type] = jss::response;
-    return jr;
+    co_return jr;
 }
 
-// Run as a coroutine.
-void
-ServerHandler::processSession(
-    std::shared_ptr<Session> const& session,
-    std::shared_ptr<JobQueue::Coro> coro)
+Task<>
+ServerHandler::processSession(std::shared_ptr<Session> const& session)
 {
-    processRequest(
+    auto const writer = co_await processRequest(
         session->port(),
         buffers_to_string(session->request().body().data()),
         session->remoteAddress().at_port(0),
         makeOutput(*session),
-        coro,
+        session->request().version() >= 11,
         forwardedFor(session->request()),
         [&] {
             auto const iter = session->request().find("X-User");
@@ -587,7 +578,10 @@ ServerHandler::processSession(
             return boost::beast::string_view{};
         }());
 
-    if (beast::rfc2616::is_keep_alive(session->request()))
+    auto const keepAlive = beast::rfc2616::is_keep_alive(session->request());
+    if (writer)
+        session->write(writer, keepAlive);
+    else if (keepAlive)
         session->complete();
     else
         session->close(true);
@@ -609,13 +603,13 @@ Json::Int constexpr server_overloaded = -32604;
 Json::Int constexpr forbidden = -32605;
 Json::Int constexpr wrong_version = -32606;
 
-void
+Task<std::shared_ptr<Writer>>
 ServerHandler::processRequest(
     Port const& port,
     std::string const& request,
     beast::IP::Endpoint const& remoteIPAddress,
     Output&& output,
-    std::shared_ptr<JobQueue::Coro> coro,
+    bool chunked,
     std::string_view forwardedFor,
     std::string_view user)
 {
@@ -633,7 +627,7 @@ ServerHandler::processRequest(
                 "Unable to parse request: " + reader.getFormatedErrorMessages(),
                 output,
                 rpcJ);
-            return;
+            co_return nullptr;
         }
     }
 
@@ -645,7 +639,7 @@ ServerHandler::processRequest(
         if (!jsonOrig.isMember(jss::params) || !jsonOrig[jss::params].isArray())
         {
             HTTPReply(400, "Malformed batch request", output, rpcJ);
-            return;
+            co_return nullptr;
         }
         size = jsonOrig[jss::params].size();
     }
@@ -689,7 +683,7 @@ ServerHandler::processRequest(
             if (!batch)
             {
                 HTTPReply(400, jss::invalid_API_version.c_str(), output, rpcJ);
-                return;
+                co_return nullptr;
             }
             Json::Value r(Json::objectValue);
             r[jss::request] = jsonRPC;
@@ -739,7 +733,7 @@ ServerHandler::processRequest(
                 if (!batch)
                 {
                     HTTPReply(503, "Server is overloaded", output, rpcJ);
-                    return;
+                    co_return nullptr;
                 }
                 Json::Value r = jsonRPC;
                 r[jss::error] =
@@ -755,7 +749,7 @@ ServerHandler::processRequest(
             if (!batch)
             {
                 HTTPReply(403, "Forbidden", output, rpcJ);
-                return;
+                co_return nullptr;
             }
             Json::Value r = jsonRPC;
             r[jss::error] = make_json_error(forbidden, "Forbidden");
@@ -769,7 +763,7 @@ ServerHandler::processRequest(
             if (!batch)
             {
                 HTTPReply(400, "Null method", output, rpcJ);
-                return;
+                co_return nullptr;
             }
             Json::Value r = jsonRPC;
             r[jss::error] = make_json_error(method_not_found, "Null method");
@@ -784,7 +778,7 @@ ServerHandler::processRequest(
             if (!batch)
             {
                 HTTPReply(400, "method is not string", output, rpcJ);
-                return;
+                co_return nullptr;
             }
             Json::Value r = jsonRPC;
             r[jss::error] =
@@ -800,7 +794,7 @@ ServerHandler::processRequest(
             if (!batch)
             {
                 HTTPReply(400, "method is empty", output, rpcJ);
-                return;
+                co_return nullptr;
             }
             Json::Value r = jsonRPC;
             r[jss::error] =
@@ -826,7 +820,7 @@ ServerHandler::processRequest(
             {
                 usage.charge(Resource::feeMalformedRPC);
                 HTTPReply(400, "params unparseable", output, rpcJ);
-                return;
+                co_return nullptr;
             }
             else
             {
@@ -835,7 +829,7 @@ ServerHandler::processRequest(
                 {
                     usage.charge(Resource::feeMalformedRPC);
                     HTTPReply(400, "params unparseable", output, rpcJ);
-                    return;
+                    co_return nullptr;
                 }
             }
         }
@@ -853,7 +847,7 @@ ServerHandler::processRequest(
                 if (!batch)
                 {
                     HTTPReply(400, "ripplerpc is not a string", output, rpcJ);
-                    return;
+                    co_return nullptr;
                 }
 
                 Json::Value r = jsonRPC;
@@ -884,6 +878,7 @@ ServerHandler::processRequest(
 
         Resource::Charge loadType = Resource::feeReferenceRPC;
 
+        RPC::Deferred deferred{m_jobQueue, jtCLIENT_RPC, "RPC-Client"};
         RPC::JsonContext context{
             {m_journal,
              app_,
@@ -892,9 +887,10 @@ ServerHandler::processRequest(
              app_.getLedgerMaster(),
              usage,
              role,
-             coro,
+             {},
              InfoSub::pointer(),
-             apiVersion},
+             apiVersion,
+             &deferred},
             params,
             {user, forwardedFor}};
         Json::Value result;
@@ -904,6 +900,8 @@ ServerHandler::processRequest(
         try
         {
             RPC::doCommand(context, result);
+            if (deferred)
+                co_await deferred.complete(result);
         }
         catch (std::exception const& ex)
         {
@@ -1020,25 +1018,28 @@ ServerHandler::processRequest(
         return 200;
     }();
 
-    auto response = to_string(reply);
-
     rpc_time_.notify(std::chrono::duration_cast<std::chrono::milliseconds>(
         std::chrono::high_resolution_clock::now() - start));
     ++rpc_requests_;
-    rpc_size_.notify(beast::insight::Event::value_type{response.size()});
-
-    response += '\n';
 
     if (auto stream = m_journal.debug())
     {
-        static int const maxSize = 10000;
-        if (response.size() <= maxSize)
-            stream << "Reply: " << response;
-        else
-            stream << "Reply: " << response.substr(0, maxSize);
+        static std::size_t const maxSize = 10000;
+        std::string response;
+        Json::IncrementalWriter(reply).write(response, maxSize);
+        response.resize(std::min(response.size(), maxSize));
+        stream << "Reply: " << response;
     }
 
-    HTTPReply(httpStatus, response, output, rpcJ);
+    // The reply is serialized as the session drains it rather than all at
+    // once, so large responses don't have to be held in memory twice.
+    co_return std::make_shared<JsonReplyWriter>(
+        httpStatus,
+        std::move(reply),
+        chunked,
+        [this](std::size_t size) {
+            rpc_size_.notify(beast::insight::Event::value_type{size});
+        });
 }
 
 //------------------------------------------------------------------------------
@@ -20,6 +20,7 @@
 #include <xrpld/app/ledger/AcceptedLedger.h>
 #include <xrpld/app/ledger/InboundLedgers.h>
 #include <xrpld/app/ledger/LedgerMaster.h>
+#include <xrpld/app/ledger/PendingSaves.h>
 #include <xrpld/app/main/Application.h>
 #include <xrpld/app/misc/NetworkOPs.h>
 #include <xrpld/app/rdb/backend/SQLiteDatabase.h>
@@ -102,12 +103,24 @@ getCountsJson(Application& app, int minObjectCount)
 
     ret[jss::write_load] = app.getNodeStore().getWriteLoad();
 
+    ret[jss::save_queue] = Json::UInt(app.pendingSaves().queued());
+    if (auto const age = app.pendingSaves().queueAge())
+        ret[jss::save_queue_age_ms] = Json::UInt(
+            std::chrono::duration_cast<std::chrono::milliseconds>(*age)
+                .count());
+
     ret[jss::historical_perminute] =
         static_cast<int>(app.getInboundLedgers().fetchRate());
     ret[jss::SLE_hit_rate] = app.cachedSLEs().rate();
     ret[jss::ledger_hit_rate] = app.getLedgerMaster().getCacheHitRate();
+    ret[jss::ledger_cache_bytes] =
+        std::to_string(app.getLedgerMaster().getCacheBytes());
+    ret[jss::ledger_cache_evictions] =
+        std::to_string(app.getLedgerMaster().getCacheEvictions());
     ret[jss::AL_size] = Json::UInt(app.getAcceptedLedgerCache().size());
     ret[jss::AL_hit_rate] = app.getAcceptedLedgerCache().getHitRate();
+    ret[jss::ledger_data_size] = Json::UInt(app.getLedgerDataCache().size());
+    ret[jss::ledger_data_hit_rate] = app.getLedgerDataCache().getHitRate();
 
     ret[jss::fullbelow_size] =
         static_cast<int>(app.getNodeFamily().getFullBelowCache()->size());
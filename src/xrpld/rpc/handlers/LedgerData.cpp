@@ -18,15 +18,18 @@
 //==============================================================================
 
 #include <xrpld/app/ledger/LedgerToJson.h>
+#include <xrpld/app/main/Application.h>
 #include <xrpld/rpc/Context.h>
 #include <xrpld/rpc/GRPCHandlers.h>
 #include <xrpld/rpc/Role.h>
 #include <xrpld/rpc/detail/RPCHelpers.h>
 #include <xrpld/rpc/detail/Tuning.h>
 
+#include <xrpl/basics/TaggedCache.ipp>
 #include <xrpl/ledger/ReadView.h>
 #include <xrpl/protocol/ErrorCodes.h>
 #include <xrpl/protocol/LedgerFormats.h>
+#include <xrpl/protocol/digest.h>
 #include <xrpl/protocol/jss.h>
 
 namespace ripple {
@@ -80,13 +83,6 @@ doLedgerData(RPC::JsonContext& context)
     jvResult[jss::ledger_hash] = to_string(lpLedger->info().hash);
     jvResult[jss::ledger_index] = lpLedger->info().seq;
 
-    if (!isMarker)
-    {
-        // Return base ledger data on first query
-        jvResult[jss::ledger] = getJson(LedgerFill(
-            *lpLedger, &context, isBinary ? LedgerFill::Options::binary : 0));
-    }
-
     auto [rpcStatus, type] = RPC::chooseLedgerEntryType(params);
     if (rpcStatus)
     {
@@ -94,41 +90,92 @@ doLedgerData(RPC::JsonContext& context)
         rpcStatus.inject(jvResult);
         return jvResult;
     }
-    Json::Value& nodes = jvResult[jss::state];
-    if (nodes.type() == Json::nullValue)
+
+    // The contents of a closed ledger never change, so the pages clients
+    // walk through are cached and served again without reading the state
+    // map or rebuilding the JSON. Unlimited callers may ask for pages of
+    // any size, and those are not kept.
+    std::optional<uint256> cacheKey;
+    if (!lpLedger->open() && limit <= maxLimit)
     {
-        nodes = Json::Value(Json::arrayValue);
+        cacheKey = sha512Half(
+            lpLedger->info().hash,
+            key,
+            isMarker,
+            isBinary,
+            static_cast<std::int32_t>(limit),
+            static_cast<std::uint16_t>(type),
+            context.apiVersion);
     }
 
-    auto e = lpLedger->sles.end();
-    for (auto i = lpLedger->sles.upper_bound(key); i != e; ++i)
+    auto& cache = context.app.getLedgerDataCache();
+    std::shared_ptr<Json::Value const> page;
+    if (cacheKey)
+        page = cache.fetch(*cacheKey);
+
+    if (!page)
     {
-        auto sle = lpLedger->read(keylet::unchecked((*i)->key()));
-        if (limit-- <= 0)
+        auto result = std::make_shared<Json::Value>(Json::objectValue);
+
+        if (!isMarker)
         {
-            // Stop processing before the current key.
-            auto k = sle->key();
-            jvResult[jss::marker] = to_string(--k);
-            break;
+            // Return base ledger data on first query
+            (*result)[jss::ledger] = getJson(LedgerFill(
+                *lpLedger,
+                &context,
+                isBinary ? LedgerFill::Options::binary : 0));
         }
 
-        if (type == ltANY || sle->getType() == type)
+        Json::Value& nodes = (*result)[jss::state] = Json::arrayValue;
+
+        auto e = lpLedger->sles.end();
+        for (auto i = lpLedger->sles.upper_bound(key); i != e; ++i)
         {
-            if (isBinary)
+            // The iterator already yields the entry: there is no need to
+            // look it up again.
+            auto const& sle = *i;
+            if (limit-- <= 0)
             {
-                Json::Value& entry = nodes.append(Json::objectValue);
-                entry[jss::data] = serializeHex(*sle);
-                entry[jss::index] = to_string(sle->key());
+                // Stop processing before the current key.
+                auto k = sle->key();
+                (*result)[jss::marker] = to_string(--k);
+                break;
             }
-            else
+
+            if (type == ltANY || sle->getType() == type)
             {
-                Json::Value& entry =
-                    nodes.append(sle->getJson(JsonOptions::none));
-                entry[jss::index] = to_string(sle->key());
+                if (isBinary)
+                {
+                    Json::Value& entry = nodes.append(Json::objectValue);
+                    entry[jss::data] = serializeHex(*sle);
+                    entry[jss::index] = to_string(sle->key());
+                }
+                else
+                {
+                    Json::Value& entry =
+                        nodes.append(sle->getJson(JsonOptions::none));
+                    entry[jss::index] = to_string(sle->key());
+                }
             }
         }
+
+        if (!cacheKey)
+        {
+            for (auto it = result->begin(); it != result->end(); ++it)
+                jvResult[it.memberName()] = std::move(*it);
+            return jvResult;
+        }
+
+        page = std::move(result);
+        cache.canonicalize_replace_client(*cacheKey, page);
     }
 
+    // Each member refers to the cached page rather than copying it; the
+    // page stays alive for as long as the reply does.
+    for (auto it = page->begin(); it != page->end(); ++it)
+        jvResult[it.memberName()] = Json::Value::share(
+            std::shared_ptr<Json::Value const>(page, &*it));
+
     return jvResult;
 }
 
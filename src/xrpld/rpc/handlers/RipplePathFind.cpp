@@ -58,6 +58,30 @@ doRipplePathFind(RPC::JsonContext& context)
         PathRequest::pointer request;
         lpLedger = context.ledgerMaster.getClosedLedger();
 
+        if (context.deferred)
+        {
+            // The caller is a stackless Task, so rather than suspend here
+            // we hand it the wait. The path-finding continuation notifies
+            // the signal, and only then does the caller ask the request
+            // for its status. If the JobQueue is stopping, the signal
+            // resumes the caller on the path-finding thread instead.
+            jvResult = context.app.getPathRequests().makeLegacyPathRequest(
+                request,
+                [signal = context.deferred->signal()]() { signal->notify(); },
+                context.consumer,
+                lpLedger,
+                context.params);
+            if (request)
+            {
+                context.deferred->defer(
+                    [request, params = context.params](Json::Value& result) {
+                        result = request->doStatus(params);
+                    });
+            }
+
+            return jvResult;
+        }
+
         // It doesn't look like there's much odd happening here, but you should
         // be aware this code runs in a JobQueue::Coro, which is a coroutine.
         // And we may be flipping around between threads.  Here's an overview:
@@ -36,6 +36,7 @@
 #include <xrpl/beast/utility/Journal.h>
 #include <xrpl/beast/utility/instrumentation.h>
 
+#include <atomic>
 #include <set>
 #include <stack>
 #include <vector>
@@ -267,6 +268,28 @@ public:
         std::function<
             void(boost::intrusive_ptr<SHAMapItem const> const&)> const&) const;
 
+    /** Return the hashes of the inner nodes nearest the root
+
+        Walks the tree breadth first, following only children that are
+        already in memory, so this never touches the node store.
+
+        @param limit The maximum number of hashes to return
+        @return The hashes, shallowest first
+    */
+    std::vector<SHAMapHash>
+    getTopInnerHashes(std::size_t limit) const;
+
+    /** Return the approximate bytes held by the nodes of this map
+
+        Only nodes already in memory are counted, so this never touches the
+        node store. Subtrees that the base map holds at the same position
+        are shared with it and are not counted.
+
+        @param base The map to share nodes with, if any
+    */
+    std::size_t
+    getMemoryFootprint(SHAMap const* base) const;
+
     // comparison/sync functions
 
     /** Check for nodes in the SHAMap not available
@@ -343,6 +366,30 @@ public:
     bool
     compare(SHAMap const& otherMap, Delta& differences, int maxCount) const;
 
+    /** Compare with another map, comparing each branch of the root on its
+        own thread.
+
+        This gives the same differences as compare, but is worthwhile for
+        large maps that differ widely. Maps that differ in fewer than about
+        a thousand items are compared on the calling thread.
+
+        The branches share the maxCount budget, so the comparison completes
+        whenever compare would. When it runs out, each thread may have
+        added one difference more than compare would have.
+
+        @note Each call that compares in parallel starts a thread for
+              each differing branch after the first, up to one fewer than
+              the number of cores, and joins them before returning. On the
+              consensus path, where the consensus lock is held, that cost
+              is paid only for sets so different that comparing them takes
+              far longer than starting the threads.
+    */
+    bool
+    compareParallel(
+        SHAMap const& otherMap,
+        Delta& differences,
+        int maxCount) const;
+
     /** Convert any modified nodes to shared. */
     int
     unshare();
@@ -351,6 +398,16 @@ public:
     int
     flushDirty(NodeObjectType t);
 
+    /** Flush modified nodes to the nodestore and convert them to shared,
+        flushing each modified branch of the root on its own thread.
+
+        This gives the same result as flushDirty, but is worthwhile when a
+        large part of the map was modified. Maps with few modified nodes are
+        flushed on the calling thread.
+    */
+    int
+    flushDirtyParallel(NodeObjectType t);
+
     void
     walkMap(std::vector<SHAMapMissingNode>& missingNodes, int maxMissing) const;
     bool
@@ -486,6 +543,13 @@ private:
     intr_ptr::SharedPtr<SHAMapTreeNode>
     descendNoStore(SHAMapInnerNode&, int branch) const;
 
+    // Read the children of these nodes that are neither in memory nor in
+    // the tree node cache with one batched node store request, so that a
+    // following descendNoStore finds them in the cache.
+    void
+    prefetchChildren(
+        std::vector<intr_ptr::SharedPtr<SHAMapInnerNode>> const& nodes) const;
+
     /** If there is only one leaf below this node, get its contents */
     boost::intrusive_ptr<SHAMapItem const> const&
     onlyBelow(SHAMapTreeNode*) const;
@@ -505,10 +569,37 @@ private:
         boost::intrusive_ptr<SHAMapItem const> const& otherMapItem,
         bool isFirstMap,
         Delta& differences,
-        int& maxCount) const;
+        std::atomic<int>& maxCount) const;
+
+    // Add the differences below two nodes of this map and otherMap
+    bool
+    compareNodes(
+        SHAMap const& otherMap,
+        SHAMapTreeNode* ourRoot,
+        SHAMapTreeNode* otherRoot,
+        Delta& differences,
+        std::atomic<int>& maxCount) const;
+
+    // Add the differences below one branch of two inner nodes
+    bool
+    compareBranch(
+        SHAMap const& otherMap,
+        SHAMapInnerNode* ours,
+        SHAMapInnerNode* other,
+        int branch,
+        Delta& differences,
+        std::atomic<int>& maxCount) const;
     int
     walkSubTree(bool doWrite, NodeObjectType t);
 
+    // Flush the modified nodes below an inner node, and then the node itself
+    intr_ptr::SharedPtr<SHAMapInnerNode>
+    walkBranch(
+        intr_ptr::SharedPtr<SHAMapInnerNode> node,
+        bool doWrite,
+        NodeObjectType t,
+        int& flushed) const;
+
     // Structure to track information about call to
     // getMissingNodes while it's in progress
     struct MissingNodes
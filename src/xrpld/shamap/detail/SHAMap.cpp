@@ -27,6 +27,9 @@
 #include <xrpl/basics/TaggedCache.ipp>
 #include <xrpl/basics/contract.h>
 
+#include <exception>
+#include <thread>
+
 namespace ripple {
 
 [[nodiscard]] intr_ptr::SharedPtr<SHAMapLeafNode>
@@ -1044,6 +1047,95 @@ SHAMap::flushDirty(NodeObjectType t)
     return walkSubTree(backed_, t);
 }
 
+int
+SHAMap::flushDirtyParallel(NodeObjectType t)
+{
+    // Below this many modified nodes on the second level of the tree the
+    // flush is quick enough that starting threads costs more than it saves.
+    static constexpr std::size_t minDirtyNodes = 64;
+
+    if (!root_ || (root_->cowid() == 0) || root_->isLeaf())
+        return flushDirty(t);
+
+    auto root = intr_ptr::static_pointer_cast<SHAMapInnerNode>(root_);
+
+    // Find the modified inner nodes below the root, and estimate the work
+    // below them from the second level of the tree
+    std::vector<int> branches;
+    std::size_t dirtyNodes = 0;
+    for (int i = 0; i < branchFactor; ++i)
+    {
+        if (root->isEmptyBranch(i))
+            continue;
+
+        auto const child = root->getChild(i);
+        if (!child || (child->cowid() == 0) || !child->isInner())
+            continue;
+
+        branches.push_back(i);
+        auto const inner = static_cast<SHAMapInnerNode*>(child.get());
+        for (int j = 0; j < branchFactor; ++j)
+        {
+            if (inner->isEmptyBranch(j))
+                continue;
+            if (auto const grandchild = inner->getChild(j);
+                grandchild && (grandchild->cowid() != 0))
+                ++dirtyNodes;
+        }
+    }
+
+    if (branches.size() < 2 || dirtyNodes < minDirtyNodes)
+        return flushDirty(t);
+
+    bool const doWrite = backed_;
+    root = preFlushNode(std::move(root));
+
+    std::vector<intr_ptr::SharedPtr<SHAMapInnerNode>> flushedBranches(
+        branches.size());
+    std::vector<int> counts(branches.size(), 0);
+    std::vector<std::exception_ptr> errors(branches.size());
+
+    std::vector<std::thread> workers;
+    workers.reserve(branches.size());
+    for (std::size_t i = 0; i < branches.size(); ++i)
+    {
+        auto child = intr_ptr::static_pointer_cast<SHAMapInnerNode>(
+            root->getChild(branches[i]));
+        workers.emplace_back([&, i, child = std::move(child)]() mutable {
+            try
+            {
+                flushedBranches[i] = walkBranch(
+                    preFlushNode(std::move(child)), doWrite, t, counts[i]);
+            }
+            catch (...)
+            {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+
+    for (auto& worker : workers)
+        worker.join();
+
+    for (auto const& error : errors)
+    {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    int flushed = 0;
+    for (std::size_t i = 0; i < branches.size(); ++i)
+    {
+        root->shareChild(branches[i], flushedBranches[i]);
+        flushed += counts[i];
+    }
+
+    // Only the leaves directly below the root and the root itself remain
+    root_ = walkBranch(std::move(root), doWrite, t, flushed);
+
+    return flushed;
+}
+
 int
 SHAMap::walkSubTree(bool doWrite, NodeObjectType t)
 {
@@ -1075,13 +1167,23 @@ SHAMap::walkSubTree(bool doWrite, NodeObjectType t)
         return 1;
     }
 
+    root_ = walkBranch(preFlushNode(std::move(node)), doWrite, t, flushed);
+
+    return flushed;
+}
+
+intr_ptr::SharedPtr<SHAMapInnerNode>
+SHAMap::walkBranch(
+    intr_ptr::SharedPtr<SHAMapInnerNode> node,
+    bool doWrite,
+    NodeObjectType t,
+    int& flushed) const
+{
     // Stack of {parent,index,child} pointers representing
     // inner nodes we are in the process of flushing
     using StackEntry = std::pair<intr_ptr::SharedPtr<SHAMapInnerNode>, int>;
     std::stack<StackEntry, std::vector<StackEntry>> stack;
 
-    node = preFlushNode(std::move(node));
-
     int pos = 0;
 
     // We can't flush an inner node until we flush its children
@@ -1125,7 +1227,7 @@ SHAMap::walkSubTree(bool doWrite, NodeObjectType t)
 
                         XRPL_ASSERT(
                             node->cowid() == cowid_,
-                            "ripple::SHAMap::walkSubTree : node cowid do "
+                            "ripple::SHAMap::walkBranch : node cowid do "
                             "match");
                         child->updateHash();
                         child->unshare();
@@ -1161,7 +1263,7 @@ SHAMap::walkSubTree(bool doWrite, NodeObjectType t)
         // Hook this inner node to its parent
         XRPL_ASSERT(
             parent->cowid() == cowid_,
-            "ripple::SHAMap::walkSubTree : parent cowid do match");
+            "ripple::SHAMap::walkBranch : parent cowid do match");
         parent->shareChild(pos, node);
 
         // Continue with parent's next child, if any
@@ -1169,10 +1271,8 @@ SHAMap::walkSubTree(bool doWrite, NodeObjectType t)
         ++pos;
     }
 
-    // Last inner node is the new root_
-    root_ = std::move(node);
-
-    return flushed;
+    // Last inner node is the new root of the branch
+    return node;
 }
 
 void
@@ -22,8 +22,13 @@
 #include <xrpl/basics/IntrusivePointer.ipp>
 #include <xrpl/basics/contract.h>
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <chrono>
+#include <exception>
 #include <stack>
+#include <thread>
 #include <vector>
 
 namespace ripple {
@@ -42,7 +47,7 @@ SHAMap::walkBranch(
     boost::intrusive_ptr<SHAMapItem const> const& otherMapItem,
     bool isFirstMap,
     Delta& differences,
-    int& maxCount) const
+    std::atomic<int>& maxCount) const
 {
     // Walk a branch of a SHAMap that's matched by an empty branch or single
     // item in the other map
@@ -137,11 +142,24 @@ SHAMap::compare(SHAMap const& otherMap, Delta& differences, int maxCount) const
     if (getHash() == otherMap.getHash())
         return true;
 
+    std::atomic<int> budget = maxCount;
+    return compareNodes(
+        otherMap, root_.get(), otherMap.root_.get(), differences, budget);
+}
+
+bool
+SHAMap::compareNodes(
+    SHAMap const& otherMap,
+    SHAMapTreeNode* ourRoot,
+    SHAMapTreeNode* otherRoot,
+    Delta& differences,
+    std::atomic<int>& maxCount) const
+{
     using StackEntry = std::pair<SHAMapTreeNode*, SHAMapTreeNode*>;
     std::stack<StackEntry, std::vector<StackEntry>>
         nodeStack;  // track nodes we've pushed
 
-    nodeStack.push({root_.get(), otherMap.root_.get()});
+    nodeStack.push({ourRoot, otherRoot});
     while (!nodeStack.empty())
     {
         auto [ourNode, otherNode] = nodeStack.top();
@@ -150,7 +168,7 @@ SHAMap::compare(SHAMap const& otherMap, Delta& differences, int maxCount) const
         if (!ourNode || !otherNode)
         {
             // LCOV_EXCL_START
-            UNREACHABLE("ripple::SHAMap::compare : missing a node");
+            UNREACHABLE("ripple::SHAMap::compareNodes : missing a node");
             Throw<SHAMapMissingNode>(type_, uint256());
             // LCOV_EXCL_STOP
         }
@@ -234,7 +252,7 @@ SHAMap::compare(SHAMap const& otherMap, Delta& differences, int maxCount) const
         else
         {
             // LCOV_EXCL_START
-            UNREACHABLE("ripple::SHAMap::compare : invalid node");
+            UNREACHABLE("ripple::SHAMap::compareNodes : invalid node");
             // LCOV_EXCL_STOP
         }
     }
@@ -242,6 +260,195 @@ SHAMap::compare(SHAMap const& otherMap, Delta& differences, int maxCount) const
     return true;
 }
 
+bool
+SHAMap::compareBranch(
+    SHAMap const& otherMap,
+    SHAMapInnerNode* ours,
+    SHAMapInnerNode* other,
+    int branch,
+    Delta& differences,
+    std::atomic<int>& maxCount) const
+{
+    if (other->isEmptyBranch(branch))
+    {
+        // We have a branch, the other tree does not
+        return walkBranch(
+            descendThrow(ours, branch), nullptr, true, differences, maxCount);
+    }
+
+    if (ours->isEmptyBranch(branch))
+    {
+        // The other tree has a branch, we do not
+        return otherMap.walkBranch(
+            otherMap.descendThrow(other, branch),
+            nullptr,
+            false,
+            differences,
+            maxCount);
+    }
+
+    return compareNodes(
+        otherMap,
+        descendThrow(ours, branch),
+        otherMap.descendThrow(other, branch),
+        differences,
+        maxCount);
+}
+
+bool
+SHAMap::compareParallel(
+    SHAMap const& otherMap,
+    Delta& differences,
+    int maxCount) const
+{
+    // Below this many differing nodes on the third level of the trees the
+    // maps are close enough that the comparison is over before threads
+    // would have started. Consensus compares while holding its lock, so
+    // only sets that differ in many transactions are worth the threads.
+    static constexpr std::size_t minDifferingNodes = 1024;
+
+    XRPL_ASSERT(
+        isValid() && otherMap.isValid(),
+        "ripple::SHAMap::compareParallel : valid state and valid input");
+
+    if (getHash() == otherMap.getHash())
+        return true;
+
+    if (!root_->isInner() || !otherMap.root_->isInner())
+        return compare(otherMap, differences, maxCount);
+
+    auto const ours = static_cast<SHAMapInnerNode*>(root_.get());
+    auto const other = static_cast<SHAMapInnerNode*>(otherMap.root_.get());
+
+    // Estimate how widely the maps differ from the third level of the
+    // trees. Each differing node on the second level stands for at most
+    // 16 there, so maps that are nearly the same are told apart without
+    // descending further.
+    struct Pair
+    {
+        SHAMapInnerNode* ours;
+        SHAMapInnerNode* other;
+        int branch;
+    };
+
+    std::vector<int> branches;
+    std::vector<Pair> differingInners;
+    std::size_t differingNodes = 0;
+    for (int i = 0; i < 16; ++i)
+    {
+        if (ours->getChildHash(i) == other->getChildHash(i))
+            continue;
+
+        branches.push_back(i);
+        if (ours->isEmptyBranch(i) || other->isEmptyBranch(i))
+        {
+            differingNodes += 16 * 16;
+            continue;
+        }
+
+        auto const ourChild = descendThrow(ours, i);
+        auto const otherChild = otherMap.descendThrow(other, i);
+        if (!ourChild->isInner() || !otherChild->isInner())
+        {
+            ++differingNodes;
+            continue;
+        }
+
+        auto const ourInner = static_cast<SHAMapInnerNode*>(ourChild);
+        auto const otherInner = static_cast<SHAMapInnerNode*>(otherChild);
+        for (int j = 0; j < 16; ++j)
+        {
+            if (ourInner->getChildHash(j) != otherInner->getChildHash(j))
+                differingInners.push_back({ourInner, otherInner, j});
+        }
+    }
+
+    if (differingNodes + differingInners.size() * 16 < minDifferingNodes)
+        return compare(otherMap, differences, maxCount);
+
+    for (auto const& [ourParent, otherParent, j] : differingInners)
+    {
+        if (differingNodes >= minDifferingNodes)
+            break;
+
+        if (ourParent->isEmptyBranch(j) || otherParent->isEmptyBranch(j))
+        {
+            differingNodes += 16;
+            continue;
+        }
+
+        auto const ourChild = descendThrow(ourParent, j);
+        auto const otherChild = otherMap.descendThrow(otherParent, j);
+        if (!ourChild->isInner() || !otherChild->isInner())
+        {
+            ++differingNodes;
+            continue;
+        }
+
+        auto const ourInner = static_cast<SHAMapInnerNode*>(ourChild);
+        auto const otherInner = static_cast<SHAMapInnerNode*>(otherChild);
+        for (int k = 0; k < 16; ++k)
+        {
+            if (ourInner->getChildHash(k) != otherInner->getChildHash(k))
+                ++differingNodes;
+        }
+    }
+
+    if (differingNodes < minDifferingNodes)
+        return compare(otherMap, differences, maxCount);
+
+    // Every branch draws on the same budget, so the comparison stops where
+    // compare would however the differences fall between the branches.
+    std::atomic<int> budget = maxCount;
+    std::atomic<bool> complete = true;
+    std::atomic<std::size_t> next = 0;
+
+    std::vector<Delta> deltas(branches.size());
+    std::vector<std::exception_ptr> errors(branches.size());
+
+    auto const work = [&]() {
+        for (auto i = next++; i < branches.size() && complete; i = next++)
+        {
+            try
+            {
+                if (!compareBranch(
+                        otherMap, ours, other, branches[i], deltas[i], budget))
+                    complete = false;
+            }
+            catch (...)
+            {
+                errors[i] = std::current_exception();
+                complete = false;
+            }
+        }
+    };
+
+    // The calling thread compares branches too
+    auto const threads = std::min<std::size_t>(
+        branches.size(), std::max(1u, std::thread::hardware_concurrency()));
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads - 1);
+    for (std::size_t i = 1; i < threads; ++i)
+        workers.emplace_back(work);
+
+    work();
+
+    for (auto& worker : workers)
+        worker.join();
+
+    for (auto const& error : errors)
+    {
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    for (auto& delta : deltas)
+        differences.merge(delta);
+
+    return complete;
+}
+
 void
 SHAMap::walkMap(std::vector<SHAMapMissingNode>& missingNodes, int maxMissing)
     const
@@ -284,6 +491,39 @@ SHAMap::walkMap(std::vector<SHAMapMissingNode>& missingNodes, int maxMissing)
     }
 }
 
+void
+SHAMap::prefetchChildren(
+    std::vector<intr_ptr::SharedPtr<SHAMapInnerNode>> const& nodes) const
+{
+    if (!backed_)
+        return;
+
+    auto const& cache = f_.getTreeNodeCache();
+    std::vector<uint256> hashes;
+    for (auto const& node : nodes)
+    {
+        for (int i = 0; i < 16; ++i)
+        {
+            if (node->isEmptyBranch(i) || node->getChild(i))
+                continue;
+            auto const& hash = node->getChildHash(i).as_uint256();
+            if (!cache->touch_if_exists(hash))
+                hashes.push_back(hash);
+        }
+    }
+
+    if (hashes.empty())
+        return;
+
+    // Objects that can't be read are left for descendNoStore to report
+    auto const objects = f_.db().fetchBatch(hashes);
+    for (std::size_t i = 0; i < objects.size(); ++i)
+    {
+        if (objects[i])
+            finishFetch(SHAMapHash{hashes[i]}, objects[i]);
+    }
+}
+
 bool
 SHAMap::walkMapParallel(
     std::vector<SHAMapMissingNode>& missingNodes,
@@ -292,11 +532,21 @@ SHAMap::walkMapParallel(
     if (!root_->isInner())  // root_ is only node, and we have it
         return false;
 
+    // The number of inner nodes whose children a worker reads at once
+    static constexpr std::size_t batchSize = 64;
+
+    // How often, in inner nodes visited, to report progress
+    static constexpr std::uint64_t progressInterval = 1'000'000;
+
+    using namespace std::chrono;
+    auto const start = steady_clock::now();
+
     using StackEntry = intr_ptr::SharedPtr<SHAMapInnerNode>;
     std::array<intr_ptr::SharedPtr<SHAMapTreeNode>, 16> topChildren;
     {
         auto const& innerRoot =
             intr_ptr::static_pointer_cast<SHAMapInnerNode>(root_);
+        prefetchChildren({innerRoot});
         for (int i = 0; i < 16; ++i)
         {
             if (!innerRoot->isEmptyBranch(i))
@@ -314,6 +564,8 @@ SHAMap::walkMapParallel(
     // and `maxMissing` from race conditions
     std::mutex m;
 
+    std::atomic<std::uint64_t> visited{1};
+
     for (int rootChildIndex = 0; rootChildIndex < 16; ++rootChildIndex)
     {
         auto const& child = topChildren[rootChildIndex];
@@ -325,42 +577,74 @@ SHAMap::walkMapParallel(
 
         JLOG(journal_.debug()) << "starting worker " << rootChildIndex;
         workers.push_back(std::thread(
-            [&m, &missingNodes, &maxMissing, &exceptions, this](
-                std::stack<StackEntry, std::vector<StackEntry>> nodeStack) {
+            [&m,
+             &missingNodes,
+             &maxMissing,
+             &exceptions,
+             &visited,
+             &start,
+             this](std::stack<StackEntry, std::vector<StackEntry>> nodeStack) {
                 try
                 {
+                    std::vector<StackEntry> batch;
+                    batch.reserve(batchSize);
                     while (!nodeStack.empty())
                     {
-                        intr_ptr::SharedPtr<SHAMapInnerNode> node =
-                            std::move(nodeStack.top());
-                        XRPL_ASSERT(
-                            node,
-                            "ripple::SHAMap::walkMapParallel : non-null node");
-                        nodeStack.pop();
-
-                        for (int i = 0; i < 16; ++i)
+                        // Take several nodes off the stack, so that their
+                        // children can be read from the backend together.
+                        batch.clear();
+                        while (!nodeStack.empty() && batch.size() < batchSize)
                         {
-                            if (node->isEmptyBranch(i))
-                                continue;
-                            intr_ptr::SharedPtr<SHAMapTreeNode> nextNode =
-                                descendNoStore(*node, i);
+                            batch.push_back(std::move(nodeStack.top()));
+                            nodeStack.pop();
+                        }
+                        prefetchChildren(batch);
 
-                            if (nextNode)
-                            {
-                                if (nextNode->isInner())
-                                    nodeStack.push(
-                                        intr_ptr::static_pointer_cast<
-                                            SHAMapInnerNode>(nextNode));
-                            }
-                            else
+                        for (auto const& node : batch)
+                        {
+                            XRPL_ASSERT(
+                                node,
+                                "ripple::SHAMap::walkMapParallel : non-null "
+                                "node");
+
+                            for (int i = 0; i < 16; ++i)
                             {
-                                std::lock_guard l{m};
-                                missingNodes.emplace_back(
-                                    type_, node->getChildHash(i));
-                                if (--maxMissing <= 0)
-                                    return;
+                                if (node->isEmptyBranch(i))
+                                    continue;
+                                intr_ptr::SharedPtr<SHAMapTreeNode> nextNode =
+                                    descendNoStore(*node, i);
+
+                                if (nextNode)
+                                {
+                                    if (nextNode->isInner())
+                                        nodeStack.push(
+                                            intr_ptr::static_pointer_cast<
+                                                SHAMapInnerNode>(nextNode));
+                                }
+                                else
+                                {
+                                    std::lock_guard l{m};
+                                    missingNodes.emplace_back(
+                                        type_, node->getChildHash(i));
+                                    if (--maxMissing <= 0)
+                                        return;
+                                }
                             }
                         }
+
+                        auto const before = visited.fetch_add(batch.size());
+                        auto const after = before + batch.size();
+                        if (before / progressInterval !=
+                            after / progressInterval)
+                        {
+                            JLOG(journal_.info())
+                                << "Walked " << after << " inner nodes of the "
+                                << to_string(type_) << " map in "
+                                << duration_cast<seconds>(
+                                       steady_clock::now() - start)
+                                       .count()
+                                << "s";
+                        }
                     }
                 }
                 catch (SHAMapMissingNode const& e)
@@ -375,6 +659,14 @@ SHAMap::walkMapParallel(
     for (std::thread& worker : workers)
         worker.join();
 
+    JLOG(journal_.info()) << "Walked " << visited.load()
+                          << " inner nodes of the " << to_string(type_)
+                          << " map in "
+                          << duration_cast<milliseconds>(
+                                 steady_clock::now() - start)
+                                 .count()
+                          << "ms";
+
     std::lock_guard l(m);
     if (exceptions.empty())
         return true;
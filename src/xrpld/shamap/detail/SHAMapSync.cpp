@@ -23,6 +23,8 @@
 
 #include <xrpl/basics/random.h>
 
+#include <deque>
+
 namespace ripple {
 
 void
@@ -99,6 +101,121 @@ SHAMap::visitNodes(std::function<bool(SHAMapTreeNode&)> const& function) const
     }
 }
 
+std::vector<SHAMapHash>
+SHAMap::getTopInnerHashes(std::size_t limit) const
+{
+    std::vector<SHAMapHash> hashes;
+    if (!root_ || !root_->isInner() || limit == 0)
+        return hashes;
+
+    std::deque<intr_ptr::SharedPtr<SHAMapInnerNode>> queue;
+    queue.push_back(intr_ptr::static_pointer_cast<SHAMapInnerNode>(root_));
+
+    while (!queue.empty() && hashes.size() < limit)
+    {
+        auto const node = std::move(queue.front());
+        queue.pop_front();
+        hashes.push_back(node->getHash());
+
+        for (int branch = 0; branch < 16; ++branch)
+        {
+            if (node->isEmptyBranch(branch))
+                continue;
+
+            // A child that isn't in memory isn't hot; skip it rather
+            // than read it from the node store.
+            auto child = node->getChild(branch);
+            if (child && child->isInner())
+                queue.push_back(
+                    intr_ptr::static_pointer_cast<SHAMapInnerNode>(
+                        std::move(child)));
+        }
+    }
+
+    return hashes;
+}
+
+std::size_t
+SHAMap::getMemoryFootprint(SHAMap const* base) const
+{
+    if (!root_)
+        return 0;
+    if (base && base->root_ && base->root_->getHash() == root_->getHash())
+        return 0;
+
+    auto nodeSize = [](SHAMapTreeNode const& node) -> std::size_t {
+        if (node.isInner())
+        {
+            auto const& inner = static_cast<SHAMapInnerNode const&>(node);
+            return sizeof(SHAMapInnerNode) +
+                inner.getBranchCount() *
+                (sizeof(SHAMapHash) +
+                 sizeof(intr_ptr::SharedPtr<SHAMapTreeNode>));
+        }
+        auto const& leaf = static_cast<SHAMapLeafNode const&>(node);
+        return sizeof(SHAMapLeafNode) + sizeof(SHAMapItem) +
+            leaf.peekItem()->size();
+    };
+
+    std::size_t bytes = nodeSize(*root_);
+    if (!root_->isInner())
+        return bytes;
+
+    // Pairs of inner nodes at the same position in this map and in the base
+    using StackEntry = std::pair<
+        intr_ptr::SharedPtr<SHAMapInnerNode>,
+        intr_ptr::SharedPtr<SHAMapInnerNode>>;
+    std::stack<StackEntry, std::vector<StackEntry>> stack;
+
+    intr_ptr::SharedPtr<SHAMapInnerNode> baseRoot;
+    if (base && base->root_ && base->root_->isInner())
+        baseRoot = intr_ptr::static_pointer_cast<SHAMapInnerNode>(base->root_);
+    stack.emplace(
+        intr_ptr::static_pointer_cast<SHAMapInnerNode>(root_),
+        std::move(baseRoot));
+
+    while (!stack.empty())
+    {
+        auto [node, other] = std::move(stack.top());
+        stack.pop();
+
+        for (int branch = 0; branch < branchFactor; ++branch)
+        {
+            if (node->isEmptyBranch(branch))
+                continue;
+
+            // The base holds the same subtree, so it isn't ours alone
+            if (other &&
+                other->getChildHash(branch) == node->getChildHash(branch))
+                continue;
+
+            // A child that isn't in memory doesn't take any
+            auto child = node->getChild(branch);
+            if (!child)
+                continue;
+
+            bytes += nodeSize(*child);
+            if (!child->isInner())
+                continue;
+
+            intr_ptr::SharedPtr<SHAMapInnerNode> otherChild;
+            if (other && !other->isEmptyBranch(branch))
+            {
+                if (auto c = other->getChild(branch); c && c->isInner())
+                    otherChild =
+                        intr_ptr::static_pointer_cast<SHAMapInnerNode>(
+                            std::move(c));
+            }
+            stack.emplace(
+                intr_ptr::static_pointer_cast<SHAMapInnerNode>(
+                    std::move(child)),
+                std::move(otherChild));
+        }
+    }
+
+    return bytes;
+}
+
 void
 SHAMap::visitDifferences(
     SHAMap const* have,